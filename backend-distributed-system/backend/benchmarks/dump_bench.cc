@@ -0,0 +1,117 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "../test_utils/test_utils.h"
+#include "../build/shardkv.grpc.pb.h"
+
+using namespace std;
+
+// Cost of a backup copying its primary with Dump. A shardkv in this process is
+// filled with N users and N posts over MigrateRange, then read back with Dump
+// at a few chunk sizes. For each, the time taken and the growth of the
+// process' peak resident memory are reported: with bounded chunks and flow
+// control, the peak should stay flat however large the store is. Servers'
+// logging goes to /dev/null.
+//
+// usage: ./dump_bench [users (and posts)] [base port]
+
+constexpr size_t LOAD_BATCH_BYTES = 1 << 20;
+
+// peak resident set of this process so far, in MB
+static double peakRssMb() {
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return atof(line.c_str() + 6) / 1024;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 500000;
+    int port = argc > 2 ? atoi(argv[2]) : 9400;
+
+    string hostname = "127.0.0.1";
+    string shardmaster_addr = hostname + ":" + to_string(port);
+    string manager_addr = hostname + ":" + to_string(port + 1);
+    string shardkv_addr = hostname + ":" + to_string(port + 2);
+
+    fflush(stdout);
+    FILE* out = fdopen(dup(STDOUT_FILENO), "w");
+    if (!freopen("/dev/null", "w", stdout)) {
+        return 1;
+    }
+
+    start_shardmaster(shardmaster_addr);
+    start_shardmanager(manager_addr, shardmaster_addr);
+    start_shardkv(shardkv_addr, manager_addr);
+    auto stub = Shardkv::NewStub(grpc::CreateChannel(shardkv_addr, grpc::InsecureChannelCredentials()));
+
+    auto start = chrono::steady_clock::now();
+    {
+        grpc::ClientContext cc;
+        auto stream = stub->MigrateRange(&cc);
+        MigrateBatch batch;
+        size_t bytes = 0;
+        uint64_t seq = 0;
+        string content(100, 'x');
+        auto flush = [&]() {
+            MigrateAck ack;
+            batch.set_seq(++seq);
+            stream->Write(batch);
+            stream->Read(&ack);
+            batch.Clear();
+            bytes = 0;
+        };
+        for (int i = 0; i < n; i++) {
+            string user = "user_" + to_string(i);
+            (*batch.mutable_users())[user] = "name_" + to_string(i);
+            MigratePost* post = batch.add_posts();
+            post->set_key("post_" + to_string(i));
+            post->set_user("user_" + to_string(i % 1000));
+            post->set_content(content);
+            bytes += 2 * user.size() + 120;
+            if (bytes >= LOAD_BATCH_BYTES) {
+                flush();
+            }
+        }
+        flush();
+        stream->WritesDone();
+        stream->Finish();
+    }
+    fprintf(out, "loaded %d users + %d posts in %.2f s, peak rss %.0f MB\n", n, n,
+            chrono::duration<double>(chrono::steady_clock::now() - start).count(), peakRssMb());
+    fprintf(out, "%12s %10s %10s %10s %10s %16s\n", "chunk bytes", "chunks", "entries", "seconds", "MB/s",
+            "peak rss growth");
+
+    for (uint32_t chunk_bytes : {64u << 10, 256u << 10, 1u << 20, 2u << 20}) {
+        double rss_before = peakRssMb();
+        DumpRequest req;
+        req.set_chunk_bytes(chunk_bytes);
+        grpc::ClientContext cc;
+        start = chrono::steady_clock::now();
+        auto reader = stub->Dump(&cc, req);
+        DumpChunk chunk;
+        size_t chunks = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        while (reader->Read(&chunk)) {
+            chunks++;
+            entries += chunk.users_size() + chunk.posts_size();
+            bytes += chunk.ByteSizeLong();
+        }
+        auto status = reader->Finish();
+        double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        fprintf(out, "%12u %10zu %10zu %10.2f %10.1f %13.0f MB%s\n", chunk_bytes, chunks, entries, elapsed,
+                bytes / 1e6 / elapsed, peakRssMb() - rss_before, status.ok() ? "" : " (failed)");
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test_utils/test_utils.h"
+#include "../build/shardkv.grpc.pb.h"
+
+using namespace std;
+
+// How long a shard is unavailable when its primary dies, as in kill_primary: a
+// primary and a backup behind one shardmanager, the primary is SIGKILLed and a
+// client keeps asking the shardmanager for a key until it is served again,
+// by the promoted backup. Each trial then starts a new backup behind the
+// survivor and kills that one in turn. Reported per trial are the window from
+// the kill to the first good answer and the failed gets meanwhile.
+//
+// Run it from build/: the shardkvs are ./shardkv processes. Their logging
+// goes to /dev/null.
+//
+// usage: ./failover_bench [trials] [base port]
+
+// a get gives up after this long, and the client tries again this much later
+constexpr chrono::milliseconds GET_DEADLINE(200);
+constexpr chrono::milliseconds RETRY_DELAY(2);
+
+static bool get(Shardkv::Stub* stub, const string& key, string* value) {
+    GetRequest req;
+    req.set_key(key);
+    GetResponse res;
+    grpc::ClientContext cc;
+    cc.set_deadline(chrono::system_clock::now() + GET_DEADLINE);
+    bool ok = stub->Get(&cc, req, &res).ok();
+    *value = res.data();
+    return ok;
+}
+
+static bool put(Shardkv::Stub* stub, const string& key, const string& value) {
+    PutRequest req;
+    req.set_key(key);
+    req.set_user("user_0");
+    req.set_data(value);
+    google::protobuf::Empty res;
+    grpc::ClientContext cc;
+    cc.set_deadline(chrono::system_clock::now() + GET_DEADLINE);
+    return stub->Put(&cc, req, &res).ok();
+}
+
+int main(int argc, char** argv) {
+    int trials = argc > 1 ? atoi(argv[1]) : 5;
+    int port = argc > 2 ? atoi(argv[2]) : 9600;
+
+    string hostname = "127.0.0.1";
+    string shardmaster_addr = hostname + ":" + to_string(port);
+    string manager_addr = hostname + ":" + to_string(port + 1);
+    auto shardkvAddr = [&](int i) { return hostname + ":" + to_string(port + 2 + i); };
+
+    fflush(stdout);
+    FILE* out = fdopen(dup(STDOUT_FILENO), "w");
+    setvbuf(out, nullptr, _IOLBF, 0);
+    if (!freopen("/dev/null", "w", stdout) || !freopen("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    start_shardmaster(shardmaster_addr);
+    start_shardmanager(manager_addr, shardmaster_addr);
+    test_join(shardmaster_addr, manager_addr, true);
+    auto manager = Shardkv::NewStub(grpc::CreateChannel(manager_addr, grpc::InsecureChannelCredentials()));
+
+    vector<pid_t> pids;
+    pid_t primary = start_shardkv_proc(shardkvAddr(0), manager_addr);
+    pids.push_back(primary);
+    // the first to ping is the primary, and it needs the config to take puts
+    const string key = "post_1";
+    string value;
+    while (!put(manager.get(), key, "hello") || !get(manager.get(), key, &value)) {
+        this_thread::sleep_for(chrono::milliseconds(100));
+    }
+
+    vector<double> windows;
+    fprintf(out, "%-6s %12s %12s\n", "trial", "window ms", "failed gets");
+    for (int trial = 1; trial <= trials; trial++) {
+        string backup_addr = shardkvAddr(trial);
+        pid_t backup = start_shardkv_proc(backup_addr, manager_addr);
+        pids.push_back(backup);
+        // wait for the backup to have copied the primary and be following it,
+        // then for it to ack that view to the shardmanager on its next pings
+        auto stub = Shardkv::NewStub(grpc::CreateChannel(backup_addr, grpc::InsecureChannelCredentials()));
+        string marker = "post_" + to_string(MAX_KEY);
+        for (int i = 0;; i++) {
+            put(manager.get(), marker, to_string(i));
+            if (get(stub.get(), marker, &value) && value == to_string(i)) {
+                break;
+            }
+            this_thread::sleep_for(chrono::milliseconds(50));
+        }
+        this_thread::sleep_for(chrono::milliseconds(500));
+
+        auto killed = chrono::steady_clock::now();
+        kill(primary, SIGKILL);
+        int failed = 0;
+        while (!get(manager.get(), key, &value) || value != "hello") {
+            failed++;
+            this_thread::sleep_for(RETRY_DELAY);
+        }
+        double window = chrono::duration<double, milli>(chrono::steady_clock::now() - killed).count();
+        windows.push_back(window);
+        fprintf(out, "%-6d %12.0f %12d\n", trial, window, failed);
+        primary = backup;
+    }
+
+    sort(windows.begin(), windows.end());
+    fprintf(out, "window ms: min %.0f, median %.0f, max %.0f\n", windows.front(), windows[windows.size() / 2],
+            windows.back());
+    cleanup_children(pids);
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/common.h"
+#include "../shardkv/kvstore.h"
+
+using namespace std;
+
+// Multi-threaded throughput of the shardkv storage engine. Each client thread
+// runs a mix of user gets/puts, post puts and timeline reads on random keys for
+// a fixed time. The striped KvStore is compared against the same tables behind
+// one global mutex, which is what a single big lock around the old maps would
+// give us.
+//
+// usage: ./kvstore_bench [seconds per run] [write percentage]
+
+constexpr int NUM_KEYS = 100000;
+constexpr int MAX_THREADS = 32;
+
+// the old layout: plain maps behind one lock
+class GlobalLockStore {
+public:
+    void PutUser(const string& key, const string& value) {
+        lock_guard<mutex> lock(m);
+        users[key] = value;
+    }
+    bool GetUser(const string& key, string* value) {
+        lock_guard<mutex> lock(m);
+        auto it = users.find(key);
+        if (it == users.end()) {
+            return false;
+        }
+        *value = it->second;
+        return true;
+    }
+    void PutPost(const string& key, const post_t& post) {
+        lock_guard<mutex> lock(m);
+        auto it = posts.find(key);
+        if (it != posts.end()) {
+            user_posts.Remove(it->second.user_id, key);
+        }
+        posts[key] = post;
+        user_posts.Add(post.user_id, key);
+    }
+    string UserPosts(const string& user) {
+        lock_guard<mutex> lock(m);
+        return user_posts.Posts(user);
+    }
+
+private:
+    mutex m;
+    map<string, string> users;
+    map<string, post_t> posts;
+    UserPostIndex user_posts;
+};
+
+template <typename Store>
+double run(Store& store, int threads, double seconds, int write_pct) {
+    atomic<bool> stop(false);
+    atomic<uint64_t> ops(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(t + 1);
+            uniform_int_distribution<int> key_dist(0, NUM_KEYS - 1);
+            uniform_int_distribution<int> op_dist(0, 99);
+            uint64_t local = 0;
+            string value;
+            while (!stop.load(memory_order_relaxed)) {
+                int id = key_dist(rng);
+                int op = op_dist(rng);
+                if (op < write_pct / 2) {
+                    store.PutUser("user_" + to_string(id), "name");
+                } else if (op < write_pct) {
+                    store.PutPost("post_" + to_string(id), {"user_" + to_string(id % 1000), "content"});
+                } else if (op < write_pct + (100 - write_pct) / 2) {
+                    store.GetUser("user_" + to_string(id), &value);
+                } else {
+                    store.UserPosts("user_" + to_string(id % 1000));
+                }
+                local++;
+            }
+            ops += local;
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop = true;
+    for (auto& w : workers) {
+        w.join();
+    }
+    return ops.load() / seconds;
+}
+
+template <typename Store>
+void preload(Store& store) {
+    for (int i = 0; i < NUM_KEYS; i++) {
+        store.PutUser("user_" + to_string(i), "name");
+        store.PutPost("post_" + to_string(i), {"user_" + to_string(i % 1000), "content"});
+    }
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 2.0;
+    int write_pct = argc > 2 ? atoi(argv[2]) : 10;
+
+    KvStore striped;
+    GlobalLockStore global;
+    preload(striped);
+    preload(global);
+
+    printf("%d%% writes, %u hardware threads\n", write_pct, thread::hardware_concurrency());
+    printf("%8s %18s %18s\n", "threads", "global lock ops/s", "striped ops/s");
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        double g = run(global, threads, seconds, write_pct);
+        double s = run(striped, threads, seconds, write_pct);
+        printf("%8d %18.0f %18.0f\n", threads, g, s);
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test_utils/test_utils.h"
+#include "../build/shardkv.grpc.pb.h"
+
+using namespace std;
+
+// Latency of requests forwarded by a shardmanager to its shardkv. A
+// shardmaster, a manager and a shardkv run in this process; client threads send
+// Gets and Puts to the manager over their own channels for a fixed time and the
+// p50/p99 of each request type is reported. Then a burst of Gets is started
+// all at once from one thread, to see how many requests the manager can have
+// in flight. Servers' logging goes to /dev/null so it doesn't dominate the
+// numbers.
+//
+// usage: ./manager_forward_bench [seconds] [client threads] [base port] [burst]
+
+constexpr int NUM_KEYS = 1000;
+
+static double percentile(vector<double>& latencies, double p) {
+    if (latencies.empty()) {
+        return 0;
+    }
+    size_t i = min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()));
+    nth_element(latencies.begin(), latencies.begin() + i, latencies.end());
+    return latencies[i];
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 5.0;
+    int threads = argc > 2 ? atoi(argv[2]) : 8;
+    int port = argc > 3 ? atoi(argv[3]) : 9300;
+    int burst = argc > 4 ? atoi(argv[4]) : 20000;
+
+    // loopback rather than our hostname, so name resolution stays out of it
+    string hostname = "127.0.0.1";
+    string shardmaster_addr = hostname + ":" + to_string(port);
+    string manager_addr = hostname + ":" + to_string(port + 1);
+    string shardkv_addr = hostname + ":" + to_string(port + 2);
+
+    fflush(stdout);
+    FILE* out = fdopen(dup(STDOUT_FILENO), "w");
+    if (!freopen("/dev/null", "w", stdout)) {
+        return 1;
+    }
+
+    start_shardmaster(shardmaster_addr);
+    start_shardmanager(manager_addr, shardmaster_addr);
+    start_shardkv(shardkv_addr, manager_addr);
+    if (!test_join(shardmaster_addr, manager_addr, true)) {
+        fprintf(out, "join failed\n");
+        return 1;
+    }
+    // wait for the shardkv to learn its shards
+    this_thread::sleep_for(chrono::seconds(2));
+    for (int i = 0; i < NUM_KEYS; i++) {
+        test_put(manager_addr, "user_" + to_string(i), "name", "", true);
+    }
+
+    vector<vector<double>> get_latencies(threads), put_latencies(threads);
+    auto end = chrono::steady_clock::now() + chrono::duration<double>(seconds);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            auto stub = Shardkv::NewStub(grpc::CreateChannel(manager_addr, grpc::InsecureChannelCredentials()));
+            for (int i = t; chrono::steady_clock::now() < end; i++) {
+                string key = "user_" + to_string(i % NUM_KEYS);
+                grpc::ClientContext cc;
+                auto start = chrono::steady_clock::now();
+                if (i % 10 == 0) {
+                    PutRequest req;
+                    req.set_key(key);
+                    req.set_data("name");
+                    google::protobuf::Empty res;
+                    stub->Put(&cc, req, &res);
+                    put_latencies[t].push_back(
+                            chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+                } else {
+                    GetRequest req;
+                    req.set_key(key);
+                    GetResponse res;
+                    stub->Get(&cc, req, &res);
+                    get_latencies[t].push_back(
+                            chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    vector<double> gets, puts;
+    for (int t = 0; t < threads; t++) {
+        gets.insert(gets.end(), get_latencies[t].begin(), get_latencies[t].end());
+        puts.insert(puts.end(), put_latencies[t].begin(), put_latencies[t].end());
+    }
+    fprintf(out, "%d client threads, %.1f s\n", threads, seconds);
+    fprintf(out, "%6s %10s %12s %12s\n", "op", "count", "p50 (us)", "p99 (us)");
+    fprintf(out, "%6s %10zu %12.0f %12.0f\n", "get", gets.size(), percentile(gets, 0.50), percentile(gets, 0.99));
+    fprintf(out, "%6s %10zu %12.0f %12.0f\n", "put", puts.size(), percentile(puts, 0.50), percentile(puts, 0.99));
+
+    // the burst: every Get is issued before any answer is waited for
+    auto stub = Shardkv::NewStub(grpc::CreateChannel(manager_addr, grpc::InsecureChannelCredentials()));
+    vector<grpc::ClientContext> contexts(burst);
+    vector<GetRequest> requests(burst);
+    vector<GetResponse> responses(burst);
+    mutex m;
+    condition_variable all_done;
+    int pending = burst;
+    atomic<int> failed(0);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < burst; i++) {
+        requests[i].set_key("user_" + to_string(i % NUM_KEYS));
+        contexts[i].set_deadline(chrono::system_clock::now() + chrono::seconds(60));
+        stub->async()->Get(&contexts[i], &requests[i], &responses[i], [&](grpc::Status status) {
+            if (!status.ok()) {
+                failed++;
+            }
+            lock_guard<mutex> lock(m);
+            if (--pending == 0) {
+                all_done.notify_one();
+            }
+        });
+    }
+    {
+        unique_lock<mutex> lock(m);
+        all_done.wait(lock, [&]() { return pending == 0; });
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    fprintf(out, "burst of %d gets: %.2f s, %.0f ops/s, %d failed\n", burst, elapsed, burst / elapsed, failed.load());
+    fflush(out);
+    // the servers run on detached threads, don't wait for them
+    _exit(0);
+}
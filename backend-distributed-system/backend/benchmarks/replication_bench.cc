@@ -0,0 +1,155 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test_utils/test_utils.h"
+#include "../build/shardkv.grpc.pb.h"
+
+using namespace std;
+
+// Cost of keeping a backup up to date. Client threads put posts straight to a
+// primary shardkv for a fixed time, first with no backup, then with a backup
+// following it over the Replicate stream (a put returns once the backup has
+// applied it). Throughput and put latency are reported for a few client
+// counts, then the backup is checked against the primary. Servers' logging
+// goes to /dev/null.
+//
+// usage: ./replication_bench [seconds per run] [base port]
+
+// post ids the workload writes, all in the key space; the last id
+// (MAX_KEY) marks the backup as caught up
+constexpr int KEYS = MAX_KEY;
+
+struct Result {
+    double puts_per_sec;
+    double p50_ms;
+    double p99_ms;
+};
+
+static Result run(const string& addr, int clients, double seconds) {
+    atomic<bool> stop{false};
+    vector<vector<double>> latencies(clients);
+    vector<thread> threads;
+    for (int c = 0; c < clients; c++) {
+        threads.emplace_back([&, c]() {
+            auto stub = Shardkv::NewStub(grpc::CreateChannel(addr, grpc::InsecureChannelCredentials()));
+            for (int i = 0; !stop; i++) {
+                PutRequest req;
+                req.set_key("post_" + to_string((c * 7919 + i) % KEYS));
+                req.set_user("user_" + to_string(c));
+                req.set_data("content " + to_string(i));
+                google::protobuf::Empty res;
+                grpc::ClientContext cc;
+                auto start = chrono::steady_clock::now();
+                if (stub->Put(&cc, req, &res).ok()) {
+                    latencies[c].push_back(
+                            chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+                }
+            }
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop = true;
+    for (thread& t : threads) {
+        t.join();
+    }
+    vector<double> all;
+    for (const auto& l : latencies) {
+        all.insert(all.end(), l.begin(), l.end());
+    }
+    sort(all.begin(), all.end());
+    if (all.empty()) {
+        return {0, 0, 0};
+    }
+    return {all.size() / seconds, all[all.size() / 2], all[all.size() * 99 / 100]};
+}
+
+static bool get(Shardkv::Stub* stub, const string& key, string* value) {
+    GetRequest req;
+    req.set_key(key);
+    GetResponse res;
+    grpc::ClientContext cc;
+    bool ok = stub->Get(&cc, req, &res).ok();
+    *value = res.data();
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 3;
+    int port = argc > 2 ? atoi(argv[2]) : 9500;
+
+    string hostname = "127.0.0.1";
+    string shardmaster_addr = hostname + ":" + to_string(port);
+    string manager_addr = hostname + ":" + to_string(port + 1);
+    string primary_addr = hostname + ":" + to_string(port + 2);
+    string backup_addr = hostname + ":" + to_string(port + 3);
+    const int client_counts[] = {1, 8, 32};
+
+    fflush(stdout);
+    FILE* out = fdopen(dup(STDOUT_FILENO), "w");
+    setvbuf(out, nullptr, _IOLBF, 0);
+    if (!freopen("/dev/null", "w", stdout) || !freopen("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    start_shardmaster(shardmaster_addr);
+    start_shardmanager(manager_addr, shardmaster_addr);
+    test_join(shardmaster_addr, manager_addr, true);
+    start_shardkv(primary_addr, manager_addr);
+    // the first to ping is the primary, and it needs the config to take puts
+    this_thread::sleep_for(chrono::seconds(1));
+
+    fprintf(out, "%-10s %8s %10s %10s %10s\n", "backup", "clients", "puts/s", "p50 ms", "p99 ms");
+    for (int clients : client_counts) {
+        Result result = run(primary_addr, clients, seconds);
+        fprintf(out, "%-10s %8d %10.0f %10.2f %10.2f\n", "none", clients, result.puts_per_sec, result.p50_ms,
+                result.p99_ms);
+    }
+
+    start_shardkv(backup_addr, manager_addr);
+    auto primary = Shardkv::NewStub(grpc::CreateChannel(primary_addr, grpc::InsecureChannelCredentials()));
+    auto backup = Shardkv::NewStub(grpc::CreateChannel(backup_addr, grpc::InsecureChannelCredentials()));
+    // wait for the backup to have copied the primary and be following it
+    auto start = chrono::steady_clock::now();
+    string value;
+    for (int i = 0;; i++) {
+        PutRequest req;
+        req.set_key("post_" + to_string(MAX_KEY));
+        req.set_user("user_0");
+        req.set_data(to_string(i));
+        google::protobuf::Empty res;
+        grpc::ClientContext cc;
+        primary->Put(&cc, req, &res);
+        if (get(backup.get(), "post_" + to_string(MAX_KEY), &value) && value == to_string(i)) {
+            break;
+        }
+        this_thread::sleep_for(chrono::milliseconds(50));
+    }
+    fprintf(out, "backup caught up in %.2f s\n",
+            chrono::duration<double>(chrono::steady_clock::now() - start).count());
+
+    for (int clients : client_counts) {
+        Result result = run(primary_addr, clients, seconds);
+        fprintf(out, "%-10s %8d %10.0f %10.2f %10.2f\n", "following", clients, result.puts_per_sec,
+                result.p50_ms, result.p99_ms);
+    }
+
+    int differ = 0;
+    for (int i = 0; i < KEYS; i++) {
+        string key = "post_" + to_string(i);
+        string on_primary;
+        string on_backup;
+        get(primary.get(), key, &on_primary);
+        get(backup.get(), key, &on_backup);
+        differ += on_primary != on_backup;
+    }
+    fprintf(out, "%d of %d posts differ between the primary and the backup\n", differ, KEYS);
+    return 0;
+}
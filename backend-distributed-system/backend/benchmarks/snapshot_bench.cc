@@ -0,0 +1,95 @@
+#include <stdlib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+
+#include "../common/common.h"
+#include "../shardkv/kvstore.h"
+#include "../shardkv/snapshot.h"
+#include "../shardkv/wal.h"
+
+using namespace std;
+
+// Time for a restarted shardkv to get its data back. A store of N users and N
+// posts is written through the write-ahead log, then rebuilt three ways:
+// replaying the whole log, loading a snapshot into a KvStore, and serving
+// lookups straight from the mmap'd snapshot without loading it.
+//
+// usage: ./snapshot_bench [users (and posts)] [directory]
+
+constexpr int LOOKUPS = 100000;
+
+double since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    string dir = string(argc > 2 ? argv[2] : "/tmp") + "/snapshot_bench.XXXXXX";
+    if (mkdtemp(&dir[0]) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    string log_path = dir + "/log";
+    string snapshot_path = dir + "/log.snapshot";
+    string content(100, 'x');
+
+    auto start = chrono::steady_clock::now();
+    {
+        KvStore store;
+        WriteAheadLog log(log_path);
+        store.SetLog(&log);
+        for (int i = 0; i < n; i++) {
+            store.PutUser("user_" + to_string(i), "name_" + to_string(i), false);
+            store.PutPost("post_" + to_string(i), {"user_" + to_string(i % 1000), content}, false);
+        }
+        store.Sync();
+        printf("%d users + %d posts written through the log in %.2f s\n", n, n, since(start));
+
+        start = chrono::steady_clock::now();
+        Snapshot::Write(store, snapshot_path, log.Rotate());
+        printf("snapshot written in %.2f s, %.1f MB\n", since(start),
+               filesystem::file_size(snapshot_path) / 1e6);
+    }
+
+    start = chrono::steady_clock::now();
+    {
+        KvStore store;
+        WriteAheadLog::Replay(log_path, 0, [&store](const WalRecord& record) { store.Apply(record); });
+        printf("%-32s %8.2f s (%zu users, %zu posts)\n", "restart by replaying the log:", since(start),
+               store.NumUsers(), store.NumPosts());
+    }
+
+    start = chrono::steady_clock::now();
+    {
+        KvStore store;
+        unique_ptr<Snapshot> snapshot = Snapshot::Open(snapshot_path);
+        store.Load(*snapshot);
+        WriteAheadLog::Replay(log_path, snapshot->FirstSegment(),
+                              [&store](const WalRecord& record) { store.Apply(record); });
+        printf("%-32s %8.2f s (%zu users, %zu posts)\n", "restart from the snapshot:", since(start),
+               store.NumUsers(), store.NumPosts());
+    }
+
+    start = chrono::steady_clock::now();
+    {
+        unique_ptr<Snapshot> snapshot = Snapshot::Open(snapshot_path);
+        double open_time = since(start);
+        mt19937 rng(1);
+        uniform_int_distribution<int> key_dist(0, n - 1);
+        string name;
+        int found = 0;
+        for (int i = 0; i < LOOKUPS; i++) {
+            found += snapshot->GetUser("user_" + to_string(key_dist(rng)), &name);
+        }
+        printf("%-32s %8.4f s, then %d lookups in %.2f s (%d found)\n", "mmap'd snapshot serving:", open_time,
+               LOOKUPS, since(start) - open_time, found);
+    }
+
+    filesystem::remove_all(dir);
+    return 0;
+}
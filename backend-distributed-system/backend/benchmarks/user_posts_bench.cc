@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../common/common.h"
+#include "../shardkv/user_post_index.h"
+
+using namespace std;
+
+// Timeline read latency (user_<id>_posts) as the number of posts stored on a
+// shardkv grows. Every user owns the same number of posts, so the indexed
+// lookup should stay flat while the old full scan of the posts map grows
+// linearly with the shard size.
+//
+// usage: ./user_posts_bench [max posts] [posts per user]
+
+constexpr size_t LOOKUPS = 10000;
+// the full scan is only measured up to this size, it gets very slow past it
+constexpr size_t MAX_SCAN_POSTS = 1000000;
+constexpr size_t SCAN_LOOKUPS = 20;
+
+static string scanPosts(const map<string, post_t>& posts, const string& user) {
+    string res;
+    for (const auto& it : posts) {
+        if (it.second.user_id == user) {
+            res += it.first + ",";
+        }
+    }
+    return res;
+}
+
+int main(int argc, char** argv) {
+    size_t max_posts = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t per_user = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10;
+
+    printf("%12s %12s %16s %16s\n", "posts", "users", "index (us/op)", "scan (us/op)");
+
+    UserPostIndex index;
+    map<string, post_t> posts;
+    size_t next_post = 0;
+    mt19937_64 rng(42);
+
+    for (size_t target = 10000; target <= max_posts; target *= 10) {
+        // grow the shard up to target posts
+        for (; next_post < target; next_post++) {
+            string key = "post_" + to_string(next_post);
+            string user = "user_" + to_string(next_post / per_user);
+            index.Add(user, key);
+            if (target <= MAX_SCAN_POSTS) {
+                posts[key] = {user, "content"};
+            }
+        }
+        size_t num_users = target / per_user;
+        uniform_int_distribution<size_t> pick(0, num_users - 1);
+
+        // keeps the lookups from being optimized away
+        volatile size_t sink = 0;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < LOOKUPS; i++) {
+            sink += index.Posts("user_" + to_string(pick(rng))).size();
+        }
+        double index_us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / LOOKUPS;
+
+        double scan_us = -1;
+        if (target <= MAX_SCAN_POSTS) {
+            start = chrono::steady_clock::now();
+            for (size_t i = 0; i < SCAN_LOOKUPS; i++) {
+                sink += scanPosts(posts, "user_" + to_string(pick(rng))).size();
+            }
+            scan_us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / SCAN_LOOKUPS;
+        } else {
+            // free the scan baseline before the index gets large
+            posts.clear();
+        }
+
+        if (scan_us < 0) {
+            printf("%12zu %12zu %16.3f %16s\n", target, num_users, index_us, "-");
+        } else {
+            printf("%12zu %12zu %16.3f %16.3f\n", target, num_users, index_us, scan_us);
+        }
+    }
+    return 0;
+}
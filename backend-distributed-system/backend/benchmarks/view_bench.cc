@@ -0,0 +1,161 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/common.h"
+#include "../shardkv/kvstore.h"
+
+using namespace std;
+
+// What a full scan (a Dump, a migration's key scan) costs the writers. Writer
+// threads keep rewriting their users for a fixed time while one thread scans
+// the whole users table over and over, three ways:
+//
+//   no scan        the writers alone
+//   writes held    each scan stops the writers until it is done, which is
+//                  what a consistent scan takes without views
+//   frozen view    each scan reads a KvStore::Freeze view while writers run
+//
+// Reported are the write throughput and the longest a single write took,
+// which is how long a scan can stall a client. Every writer rewrites its keys
+// in order with a growing generation, so a consistent scan sees, per writer,
+// generations that never go up along its keys and span at most two values.
+// Each scan is checked for that, and the old versions kept for the views are
+// reported while they are open and after the last one is released.
+//
+// usage: ./view_bench [seconds per run] [writer threads] [users per writer]
+
+struct Result {
+    double writes_per_sec;
+    double max_write_ms;
+    size_t scans;
+    size_t inconsistent;
+    size_t peak_old_versions;
+    size_t old_versions_left;
+};
+
+static string userKey(int writer, int i) {
+    return "user_" + to_string(writer) + "_" + to_string(i);
+}
+
+// whether the generations seen for each writer's keys could all have been
+// there at the same time
+static bool consistent(const vector<vector<long>>& seen) {
+    for (const auto& generations : seen) {
+        for (size_t i = 1; i < generations.size(); i++) {
+            if (generations[i] > generations[i - 1] || generations[0] - generations[i] > 1) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+enum class Mode { NO_SCAN, WRITES_HELD, FROZEN_VIEW };
+
+static Result run(Mode mode, double seconds, int writers, int keys) {
+    KvStore store;
+    for (int w = 0; w < writers; w++) {
+        for (int i = 0; i < keys; i++) {
+            store.PutUser(userKey(w, i), "0");
+        }
+    }
+
+    atomic<bool> stop{false};
+    atomic<size_t> writes{0};
+    // writers hold it shared, a scan in WRITES_HELD mode exclusively. held
+    // keeps new writers out meanwhile, so that the scan doesn't starve.
+    shared_mutex gate;
+    atomic<bool> held{false};
+    mutex max_mutex;
+    chrono::steady_clock::duration max_write{0};
+
+    vector<thread> threads;
+    for (int w = 0; w < writers; w++) {
+        threads.emplace_back([&, w]() {
+            size_t done = 0;
+            chrono::steady_clock::duration longest{0};
+            for (long generation = 1; !stop; generation++) {
+                for (int i = 0; i < keys && !stop; i++) {
+                    auto start = chrono::steady_clock::now();
+                    while (held) {
+                        this_thread::yield();
+                    }
+                    {
+                        shared_lock<shared_mutex> lock(gate);
+                        store.PutUser(userKey(w, i), to_string(generation));
+                    }
+                    longest = max(longest, chrono::steady_clock::now() - start);
+                    done++;
+                }
+            }
+            writes += done;
+            lock_guard<mutex> lock(max_mutex);
+            max_write = max(max_write, longest);
+        });
+    }
+
+    Result result{0, 0, 0, 0, 0, 0};
+    thread scanner([&]() {
+        while (mode != Mode::NO_SCAN && !stop) {
+            vector<vector<long>> seen(writers, vector<long>(keys));
+            auto scan = [&](const KvStore::View& view) {
+                view.ForEachUser([&seen](const string& key, const string& name) {
+                    size_t split = key.rfind('_');
+                    int w = atoi(key.c_str() + 5);
+                    seen[w][atoi(key.c_str() + split + 1)] = atol(name.c_str());
+                });
+            };
+            if (mode == Mode::WRITES_HELD) {
+                held = true;
+                unique_lock<shared_mutex> lock(gate);
+                scan(*store.Freeze());
+                held = false;
+            } else {
+                auto view = store.Freeze();
+                scan(*view);
+                result.peak_old_versions = max(result.peak_old_versions, store.NumOldVersions());
+            }
+            result.scans++;
+            result.inconsistent += !consistent(seen);
+        }
+    });
+
+    auto start = chrono::steady_clock::now();
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop = true;
+    for (thread& t : threads) {
+        t.join();
+    }
+    scanner.join();
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    result.writes_per_sec = writes / elapsed;
+    result.max_write_ms = chrono::duration<double, milli>(max_write).count();
+    result.old_versions_left = store.NumOldVersions();
+    return result;
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 3;
+    int writers = argc > 2 ? atoi(argv[2]) : 4;
+    int keys = argc > 3 ? atoi(argv[3]) : 50000;
+
+    printf("%d writers x %d users, %.1f s per run\n", writers, keys, seconds);
+    printf("%-12s %10s %14s %6s %13s %18s %10s\n", "scan", "writes/s", "max write ms", "scans", "inconsistent",
+           "peak old versions", "left over");
+    const pair<Mode, const char*> modes[] = {
+            {Mode::NO_SCAN, "no scan"}, {Mode::WRITES_HELD, "writes held"}, {Mode::FROZEN_VIEW, "frozen view"}};
+    for (const auto& mode : modes) {
+        Result result = run(mode.first, seconds, writers, keys);
+        printf("%-12s %10.0f %14.1f %6zu %13zu %18zu %10zu\n", mode.second, result.writes_per_sec,
+               result.max_write_ms, result.scans, result.inconsistent, result.peak_old_versions,
+               result.old_versions_left);
+    }
+    return 0;
+}
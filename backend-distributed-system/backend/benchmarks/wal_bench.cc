@@ -0,0 +1,93 @@
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/common.h"
+#include "../shardkv/kvstore.h"
+#include "../shardkv/wal.h"
+
+using namespace std;
+
+// Write throughput of the shardkv storage engine with and without the
+// write-ahead log. Each client thread puts users and posts on random keys for a
+// fixed time; with the log on, a put only returns once it is on disk. The
+// number of fdatasyncs shows how many writers group commit folds into one.
+// The log is then replayed into an empty store to time recovery.
+//
+// usage: ./wal_bench [seconds per run] [log directory]
+
+constexpr int NUM_KEYS = 100000;
+constexpr int MAX_THREADS = 64;
+
+double run(KvStore& store, int threads, double seconds) {
+    atomic<bool> stop(false);
+    atomic<uint64_t> ops(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(t + 1);
+            uniform_int_distribution<int> key_dist(0, NUM_KEYS - 1);
+            uint64_t local = 0;
+            while (!stop.load(memory_order_relaxed)) {
+                int id = key_dist(rng);
+                if (id % 2 == 0) {
+                    store.PutUser("user_" + to_string(id), "name");
+                } else {
+                    store.PutPost("post_" + to_string(id), {"user_" + to_string(id % 1000), "content"});
+                }
+                local++;
+            }
+            ops += local;
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop = true;
+    for (auto& w : workers) {
+        w.join();
+    }
+    return ops.load() / seconds;
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? atof(argv[1]) : 2.0;
+    string dir = string(argc > 2 ? argv[2] : "/tmp") + "/wal_bench.XXXXXX";
+    if (mkdtemp(&dir[0]) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    string path = dir + "/log";
+
+    printf("%8s %14s %14s %12s %14s\n", "threads", "no log ops/s", "log ops/s", "fdatasyncs",
+           "writes/sync");
+    uint64_t logged = 0;
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 4) {
+        KvStore volatile_store;
+        double off = run(volatile_store, threads, seconds);
+
+        KvStore durable_store;
+        WriteAheadLog log(path);
+        durable_store.SetLog(&log);
+        double on = run(durable_store, threads, seconds);
+        uint64_t syncs = log.Syncs();
+        logged += log.LastSeq();
+        printf("%8d %14.0f %14.0f %12lu %14.1f\n", threads, off, on, syncs,
+               syncs ? static_cast<double>(log.LastSeq()) / syncs : 0.0);
+    }
+
+    KvStore recovered;
+    auto start = chrono::steady_clock::now();
+    size_t changes = WriteAheadLog::Replay(path, 0, [&](const WalRecord& record) { recovered.Apply(record); });
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("replayed %zu of %lu changes in %.2f s: %zu users, %zu posts\n", changes, logged, elapsed,
+           recovered.NumUsers(), recovered.NumPosts());
+    filesystem::remove_all(dir);
+    return 0;
+}
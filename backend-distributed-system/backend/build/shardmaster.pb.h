@@ -0,0 +1,1752 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: shardmaster.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_shardmaster_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_shardmaster_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/empty.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_shardmaster_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_shardmaster_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_shardmaster_2eproto;
+class ConfigEntry;
+struct ConfigEntryDefaultTypeInternal;
+extern ConfigEntryDefaultTypeInternal _ConfigEntry_default_instance_;
+class GDPRDeleteRequest;
+struct GDPRDeleteRequestDefaultTypeInternal;
+extern GDPRDeleteRequestDefaultTypeInternal _GDPRDeleteRequest_default_instance_;
+class JoinRequest;
+struct JoinRequestDefaultTypeInternal;
+extern JoinRequestDefaultTypeInternal _JoinRequest_default_instance_;
+class LeaveRequest;
+struct LeaveRequestDefaultTypeInternal;
+extern LeaveRequestDefaultTypeInternal _LeaveRequest_default_instance_;
+class MoveRequest;
+struct MoveRequestDefaultTypeInternal;
+extern MoveRequestDefaultTypeInternal _MoveRequest_default_instance_;
+class QueryResponse;
+struct QueryResponseDefaultTypeInternal;
+extern QueryResponseDefaultTypeInternal _QueryResponse_default_instance_;
+class Shard;
+struct ShardDefaultTypeInternal;
+extern ShardDefaultTypeInternal _Shard_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ConfigEntry* Arena::CreateMaybeMessage<::ConfigEntry>(Arena*);
+template<> ::GDPRDeleteRequest* Arena::CreateMaybeMessage<::GDPRDeleteRequest>(Arena*);
+template<> ::JoinRequest* Arena::CreateMaybeMessage<::JoinRequest>(Arena*);
+template<> ::LeaveRequest* Arena::CreateMaybeMessage<::LeaveRequest>(Arena*);
+template<> ::MoveRequest* Arena::CreateMaybeMessage<::MoveRequest>(Arena*);
+template<> ::QueryResponse* Arena::CreateMaybeMessage<::QueryResponse>(Arena*);
+template<> ::Shard* Arena::CreateMaybeMessage<::Shard>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+// ===================================================================
+
+class Shard final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Shard) */ {
+ public:
+  inline Shard() : Shard(nullptr) {}
+  ~Shard() override;
+  explicit PROTOBUF_CONSTEXPR Shard(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Shard(const Shard& from);
+  Shard(Shard&& from) noexcept
+    : Shard() {
+    *this = ::std::move(from);
+  }
+
+  inline Shard& operator=(const Shard& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Shard& operator=(Shard&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Shard& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Shard* internal_default_instance() {
+    return reinterpret_cast<const Shard*>(
+               &_Shard_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Shard& a, Shard& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Shard* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Shard* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Shard* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Shard>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Shard& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Shard& from) {
+    Shard::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Shard* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Shard";
+  }
+  protected:
+  explicit Shard(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLowerFieldNumber = 1,
+    kUpperFieldNumber = 2,
+  };
+  // uint32 lower = 1;
+  void clear_lower();
+  uint32_t lower() const;
+  void set_lower(uint32_t value);
+  private:
+  uint32_t _internal_lower() const;
+  void _internal_set_lower(uint32_t value);
+  public:
+
+  // uint32 upper = 2;
+  void clear_upper();
+  uint32_t upper() const;
+  void set_upper(uint32_t value);
+  private:
+  uint32_t _internal_upper() const;
+  void _internal_set_upper(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Shard)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t lower_;
+    uint32_t upper_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JoinRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:JoinRequest) */ {
+ public:
+  inline JoinRequest() : JoinRequest(nullptr) {}
+  ~JoinRequest() override;
+  explicit PROTOBUF_CONSTEXPR JoinRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JoinRequest(const JoinRequest& from);
+  JoinRequest(JoinRequest&& from) noexcept
+    : JoinRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline JoinRequest& operator=(const JoinRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JoinRequest& operator=(JoinRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JoinRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JoinRequest* internal_default_instance() {
+    return reinterpret_cast<const JoinRequest*>(
+               &_JoinRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(JoinRequest& a, JoinRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JoinRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JoinRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JoinRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JoinRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JoinRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JoinRequest& from) {
+    JoinRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JoinRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "JoinRequest";
+  }
+  protected:
+  explicit JoinRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerFieldNumber = 1,
+  };
+  // string server = 1;
+  void clear_server();
+  const std::string& server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server();
+  PROTOBUF_NODISCARD std::string* release_server();
+  void set_allocated_server(std::string* server);
+  private:
+  const std::string& _internal_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server(const std::string& value);
+  std::string* _internal_mutable_server();
+  public:
+
+  // @@protoc_insertion_point(class_scope:JoinRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LeaveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LeaveRequest) */ {
+ public:
+  inline LeaveRequest() : LeaveRequest(nullptr) {}
+  ~LeaveRequest() override;
+  explicit PROTOBUF_CONSTEXPR LeaveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LeaveRequest(const LeaveRequest& from);
+  LeaveRequest(LeaveRequest&& from) noexcept
+    : LeaveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LeaveRequest& operator=(const LeaveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LeaveRequest& operator=(LeaveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LeaveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LeaveRequest* internal_default_instance() {
+    return reinterpret_cast<const LeaveRequest*>(
+               &_LeaveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(LeaveRequest& a, LeaveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LeaveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LeaveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LeaveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LeaveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LeaveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LeaveRequest& from) {
+    LeaveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LeaveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LeaveRequest";
+  }
+  protected:
+  explicit LeaveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServersFieldNumber = 1,
+  };
+  // repeated string servers = 1;
+  int servers_size() const;
+  private:
+  int _internal_servers_size() const;
+  public:
+  void clear_servers();
+  const std::string& servers(int index) const;
+  std::string* mutable_servers(int index);
+  void set_servers(int index, const std::string& value);
+  void set_servers(int index, std::string&& value);
+  void set_servers(int index, const char* value);
+  void set_servers(int index, const char* value, size_t size);
+  std::string* add_servers();
+  void add_servers(const std::string& value);
+  void add_servers(std::string&& value);
+  void add_servers(const char* value);
+  void add_servers(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& servers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_servers();
+  private:
+  const std::string& _internal_servers(int index) const;
+  std::string* _internal_add_servers();
+  public:
+
+  // @@protoc_insertion_point(class_scope:LeaveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> servers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MoveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MoveRequest) */ {
+ public:
+  inline MoveRequest() : MoveRequest(nullptr) {}
+  ~MoveRequest() override;
+  explicit PROTOBUF_CONSTEXPR MoveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MoveRequest(const MoveRequest& from);
+  MoveRequest(MoveRequest&& from) noexcept
+    : MoveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MoveRequest& operator=(const MoveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MoveRequest& operator=(MoveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MoveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MoveRequest* internal_default_instance() {
+    return reinterpret_cast<const MoveRequest*>(
+               &_MoveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MoveRequest& a, MoveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MoveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MoveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MoveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MoveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MoveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MoveRequest& from) {
+    MoveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MoveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MoveRequest";
+  }
+  protected:
+  explicit MoveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerFieldNumber = 1,
+    kShardFieldNumber = 2,
+  };
+  // string server = 1;
+  void clear_server();
+  const std::string& server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server();
+  PROTOBUF_NODISCARD std::string* release_server();
+  void set_allocated_server(std::string* server);
+  private:
+  const std::string& _internal_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server(const std::string& value);
+  std::string* _internal_mutable_server();
+  public:
+
+  // .Shard shard = 2;
+  bool has_shard() const;
+  private:
+  bool _internal_has_shard() const;
+  public:
+  void clear_shard();
+  const ::Shard& shard() const;
+  PROTOBUF_NODISCARD ::Shard* release_shard();
+  ::Shard* mutable_shard();
+  void set_allocated_shard(::Shard* shard);
+  private:
+  const ::Shard& _internal_shard() const;
+  ::Shard* _internal_mutable_shard();
+  public:
+  void unsafe_arena_set_allocated_shard(
+      ::Shard* shard);
+  ::Shard* unsafe_arena_release_shard();
+
+  // @@protoc_insertion_point(class_scope:MoveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
+    ::Shard* shard_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConfigEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ConfigEntry) */ {
+ public:
+  inline ConfigEntry() : ConfigEntry(nullptr) {}
+  ~ConfigEntry() override;
+  explicit PROTOBUF_CONSTEXPR ConfigEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfigEntry(const ConfigEntry& from);
+  ConfigEntry(ConfigEntry&& from) noexcept
+    : ConfigEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ConfigEntry& operator=(const ConfigEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConfigEntry& operator=(ConfigEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfigEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfigEntry* internal_default_instance() {
+    return reinterpret_cast<const ConfigEntry*>(
+               &_ConfigEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ConfigEntry& a, ConfigEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfigEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfigEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConfigEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfigEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfigEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfigEntry& from) {
+    ConfigEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConfigEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ConfigEntry";
+  }
+  protected:
+  explicit ConfigEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShardsFieldNumber = 2,
+    kServerFieldNumber = 3,
+  };
+  // repeated .Shard shards = 2;
+  int shards_size() const;
+  private:
+  int _internal_shards_size() const;
+  public:
+  void clear_shards();
+  ::Shard* mutable_shards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Shard >*
+      mutable_shards();
+  private:
+  const ::Shard& _internal_shards(int index) const;
+  ::Shard* _internal_add_shards();
+  public:
+  const ::Shard& shards(int index) const;
+  ::Shard* add_shards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Shard >&
+      shards() const;
+
+  // string server = 3;
+  void clear_server();
+  const std::string& server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server();
+  PROTOBUF_NODISCARD std::string* release_server();
+  void set_allocated_server(std::string* server);
+  private:
+  const std::string& _internal_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server(const std::string& value);
+  std::string* _internal_mutable_server();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ConfigEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Shard > shards_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:QueryResponse) */ {
+ public:
+  inline QueryResponse() : QueryResponse(nullptr) {}
+  ~QueryResponse() override;
+  explicit PROTOBUF_CONSTEXPR QueryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueryResponse(const QueryResponse& from);
+  QueryResponse(QueryResponse&& from) noexcept
+    : QueryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline QueryResponse& operator=(const QueryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueryResponse& operator=(QueryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueryResponse* internal_default_instance() {
+    return reinterpret_cast<const QueryResponse*>(
+               &_QueryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(QueryResponse& a, QueryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  QueryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueryResponse& from) {
+    QueryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "QueryResponse";
+  }
+  protected:
+  explicit QueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConfigFieldNumber = 1,
+  };
+  // repeated .ConfigEntry config = 1;
+  int config_size() const;
+  private:
+  int _internal_config_size() const;
+  public:
+  void clear_config();
+  ::ConfigEntry* mutable_config(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ConfigEntry >*
+      mutable_config();
+  private:
+  const ::ConfigEntry& _internal_config(int index) const;
+  ::ConfigEntry* _internal_add_config();
+  public:
+  const ::ConfigEntry& config(int index) const;
+  ::ConfigEntry* add_config();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ConfigEntry >&
+      config() const;
+
+  // @@protoc_insertion_point(class_scope:QueryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ConfigEntry > config_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GDPRDeleteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GDPRDeleteRequest) */ {
+ public:
+  inline GDPRDeleteRequest() : GDPRDeleteRequest(nullptr) {}
+  ~GDPRDeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR GDPRDeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GDPRDeleteRequest(const GDPRDeleteRequest& from);
+  GDPRDeleteRequest(GDPRDeleteRequest&& from) noexcept
+    : GDPRDeleteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GDPRDeleteRequest& operator=(const GDPRDeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GDPRDeleteRequest& operator=(GDPRDeleteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GDPRDeleteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GDPRDeleteRequest* internal_default_instance() {
+    return reinterpret_cast<const GDPRDeleteRequest*>(
+               &_GDPRDeleteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(GDPRDeleteRequest& a, GDPRDeleteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GDPRDeleteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GDPRDeleteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GDPRDeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GDPRDeleteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GDPRDeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GDPRDeleteRequest& from) {
+    GDPRDeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GDPRDeleteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GDPRDeleteRequest";
+  }
+  protected:
+  explicit GDPRDeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:GDPRDeleteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_shardmaster_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Shard
+
+// uint32 lower = 1;
+inline void Shard::clear_lower() {
+  _impl_.lower_ = 0u;
+}
+inline uint32_t Shard::_internal_lower() const {
+  return _impl_.lower_;
+}
+inline uint32_t Shard::lower() const {
+  // @@protoc_insertion_point(field_get:Shard.lower)
+  return _internal_lower();
+}
+inline void Shard::_internal_set_lower(uint32_t value) {
+  
+  _impl_.lower_ = value;
+}
+inline void Shard::set_lower(uint32_t value) {
+  _internal_set_lower(value);
+  // @@protoc_insertion_point(field_set:Shard.lower)
+}
+
+// uint32 upper = 2;
+inline void Shard::clear_upper() {
+  _impl_.upper_ = 0u;
+}
+inline uint32_t Shard::_internal_upper() const {
+  return _impl_.upper_;
+}
+inline uint32_t Shard::upper() const {
+  // @@protoc_insertion_point(field_get:Shard.upper)
+  return _internal_upper();
+}
+inline void Shard::_internal_set_upper(uint32_t value) {
+  
+  _impl_.upper_ = value;
+}
+inline void Shard::set_upper(uint32_t value) {
+  _internal_set_upper(value);
+  // @@protoc_insertion_point(field_set:Shard.upper)
+}
+
+// -------------------------------------------------------------------
+
+// JoinRequest
+
+// string server = 1;
+inline void JoinRequest::clear_server() {
+  _impl_.server_.ClearToEmpty();
+}
+inline const std::string& JoinRequest::server() const {
+  // @@protoc_insertion_point(field_get:JoinRequest.server)
+  return _internal_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JoinRequest::set_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:JoinRequest.server)
+}
+inline std::string* JoinRequest::mutable_server() {
+  std::string* _s = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:JoinRequest.server)
+  return _s;
+}
+inline const std::string& JoinRequest::_internal_server() const {
+  return _impl_.server_.Get();
+}
+inline void JoinRequest::_internal_set_server(const std::string& value) {
+  
+  _impl_.server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JoinRequest::_internal_mutable_server() {
+  
+  return _impl_.server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JoinRequest::release_server() {
+  // @@protoc_insertion_point(field_release:JoinRequest.server)
+  return _impl_.server_.Release();
+}
+inline void JoinRequest::set_allocated_server(std::string* server) {
+  if (server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:JoinRequest.server)
+}
+
+// -------------------------------------------------------------------
+
+// LeaveRequest
+
+// repeated string servers = 1;
+inline int LeaveRequest::_internal_servers_size() const {
+  return _impl_.servers_.size();
+}
+inline int LeaveRequest::servers_size() const {
+  return _internal_servers_size();
+}
+inline void LeaveRequest::clear_servers() {
+  _impl_.servers_.Clear();
+}
+inline std::string* LeaveRequest::add_servers() {
+  std::string* _s = _internal_add_servers();
+  // @@protoc_insertion_point(field_add_mutable:LeaveRequest.servers)
+  return _s;
+}
+inline const std::string& LeaveRequest::_internal_servers(int index) const {
+  return _impl_.servers_.Get(index);
+}
+inline const std::string& LeaveRequest::servers(int index) const {
+  // @@protoc_insertion_point(field_get:LeaveRequest.servers)
+  return _internal_servers(index);
+}
+inline std::string* LeaveRequest::mutable_servers(int index) {
+  // @@protoc_insertion_point(field_mutable:LeaveRequest.servers)
+  return _impl_.servers_.Mutable(index);
+}
+inline void LeaveRequest::set_servers(int index, const std::string& value) {
+  _impl_.servers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:LeaveRequest.servers)
+}
+inline void LeaveRequest::set_servers(int index, std::string&& value) {
+  _impl_.servers_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:LeaveRequest.servers)
+}
+inline void LeaveRequest::set_servers(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.servers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:LeaveRequest.servers)
+}
+inline void LeaveRequest::set_servers(int index, const char* value, size_t size) {
+  _impl_.servers_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:LeaveRequest.servers)
+}
+inline std::string* LeaveRequest::_internal_add_servers() {
+  return _impl_.servers_.Add();
+}
+inline void LeaveRequest::add_servers(const std::string& value) {
+  _impl_.servers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:LeaveRequest.servers)
+}
+inline void LeaveRequest::add_servers(std::string&& value) {
+  _impl_.servers_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:LeaveRequest.servers)
+}
+inline void LeaveRequest::add_servers(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.servers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:LeaveRequest.servers)
+}
+inline void LeaveRequest::add_servers(const char* value, size_t size) {
+  _impl_.servers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:LeaveRequest.servers)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+LeaveRequest::servers() const {
+  // @@protoc_insertion_point(field_list:LeaveRequest.servers)
+  return _impl_.servers_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+LeaveRequest::mutable_servers() {
+  // @@protoc_insertion_point(field_mutable_list:LeaveRequest.servers)
+  return &_impl_.servers_;
+}
+
+// -------------------------------------------------------------------
+
+// MoveRequest
+
+// string server = 1;
+inline void MoveRequest::clear_server() {
+  _impl_.server_.ClearToEmpty();
+}
+inline const std::string& MoveRequest::server() const {
+  // @@protoc_insertion_point(field_get:MoveRequest.server)
+  return _internal_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MoveRequest::set_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MoveRequest.server)
+}
+inline std::string* MoveRequest::mutable_server() {
+  std::string* _s = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:MoveRequest.server)
+  return _s;
+}
+inline const std::string& MoveRequest::_internal_server() const {
+  return _impl_.server_.Get();
+}
+inline void MoveRequest::_internal_set_server(const std::string& value) {
+  
+  _impl_.server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MoveRequest::_internal_mutable_server() {
+  
+  return _impl_.server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MoveRequest::release_server() {
+  // @@protoc_insertion_point(field_release:MoveRequest.server)
+  return _impl_.server_.Release();
+}
+inline void MoveRequest::set_allocated_server(std::string* server) {
+  if (server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MoveRequest.server)
+}
+
+// .Shard shard = 2;
+inline bool MoveRequest::_internal_has_shard() const {
+  return this != internal_default_instance() && _impl_.shard_ != nullptr;
+}
+inline bool MoveRequest::has_shard() const {
+  return _internal_has_shard();
+}
+inline void MoveRequest::clear_shard() {
+  if (GetArenaForAllocation() == nullptr && _impl_.shard_ != nullptr) {
+    delete _impl_.shard_;
+  }
+  _impl_.shard_ = nullptr;
+}
+inline const ::Shard& MoveRequest::_internal_shard() const {
+  const ::Shard* p = _impl_.shard_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Shard&>(
+      ::_Shard_default_instance_);
+}
+inline const ::Shard& MoveRequest::shard() const {
+  // @@protoc_insertion_point(field_get:MoveRequest.shard)
+  return _internal_shard();
+}
+inline void MoveRequest::unsafe_arena_set_allocated_shard(
+    ::Shard* shard) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shard_);
+  }
+  _impl_.shard_ = shard;
+  if (shard) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MoveRequest.shard)
+}
+inline ::Shard* MoveRequest::release_shard() {
+  
+  ::Shard* temp = _impl_.shard_;
+  _impl_.shard_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Shard* MoveRequest::unsafe_arena_release_shard() {
+  // @@protoc_insertion_point(field_release:MoveRequest.shard)
+  
+  ::Shard* temp = _impl_.shard_;
+  _impl_.shard_ = nullptr;
+  return temp;
+}
+inline ::Shard* MoveRequest::_internal_mutable_shard() {
+  
+  if (_impl_.shard_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Shard>(GetArenaForAllocation());
+    _impl_.shard_ = p;
+  }
+  return _impl_.shard_;
+}
+inline ::Shard* MoveRequest::mutable_shard() {
+  ::Shard* _msg = _internal_mutable_shard();
+  // @@protoc_insertion_point(field_mutable:MoveRequest.shard)
+  return _msg;
+}
+inline void MoveRequest::set_allocated_shard(::Shard* shard) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.shard_;
+  }
+  if (shard) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shard);
+    if (message_arena != submessage_arena) {
+      shard = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shard, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.shard_ = shard;
+  // @@protoc_insertion_point(field_set_allocated:MoveRequest.shard)
+}
+
+// -------------------------------------------------------------------
+
+// ConfigEntry
+
+// repeated .Shard shards = 2;
+inline int ConfigEntry::_internal_shards_size() const {
+  return _impl_.shards_.size();
+}
+inline int ConfigEntry::shards_size() const {
+  return _internal_shards_size();
+}
+inline void ConfigEntry::clear_shards() {
+  _impl_.shards_.Clear();
+}
+inline ::Shard* ConfigEntry::mutable_shards(int index) {
+  // @@protoc_insertion_point(field_mutable:ConfigEntry.shards)
+  return _impl_.shards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Shard >*
+ConfigEntry::mutable_shards() {
+  // @@protoc_insertion_point(field_mutable_list:ConfigEntry.shards)
+  return &_impl_.shards_;
+}
+inline const ::Shard& ConfigEntry::_internal_shards(int index) const {
+  return _impl_.shards_.Get(index);
+}
+inline const ::Shard& ConfigEntry::shards(int index) const {
+  // @@protoc_insertion_point(field_get:ConfigEntry.shards)
+  return _internal_shards(index);
+}
+inline ::Shard* ConfigEntry::_internal_add_shards() {
+  return _impl_.shards_.Add();
+}
+inline ::Shard* ConfigEntry::add_shards() {
+  ::Shard* _add = _internal_add_shards();
+  // @@protoc_insertion_point(field_add:ConfigEntry.shards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Shard >&
+ConfigEntry::shards() const {
+  // @@protoc_insertion_point(field_list:ConfigEntry.shards)
+  return _impl_.shards_;
+}
+
+// string server = 3;
+inline void ConfigEntry::clear_server() {
+  _impl_.server_.ClearToEmpty();
+}
+inline const std::string& ConfigEntry::server() const {
+  // @@protoc_insertion_point(field_get:ConfigEntry.server)
+  return _internal_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConfigEntry::set_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ConfigEntry.server)
+}
+inline std::string* ConfigEntry::mutable_server() {
+  std::string* _s = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:ConfigEntry.server)
+  return _s;
+}
+inline const std::string& ConfigEntry::_internal_server() const {
+  return _impl_.server_.Get();
+}
+inline void ConfigEntry::_internal_set_server(const std::string& value) {
+  
+  _impl_.server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConfigEntry::_internal_mutable_server() {
+  
+  return _impl_.server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConfigEntry::release_server() {
+  // @@protoc_insertion_point(field_release:ConfigEntry.server)
+  return _impl_.server_.Release();
+}
+inline void ConfigEntry::set_allocated_server(std::string* server) {
+  if (server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ConfigEntry.server)
+}
+
+// -------------------------------------------------------------------
+
+// QueryResponse
+
+// repeated .ConfigEntry config = 1;
+inline int QueryResponse::_internal_config_size() const {
+  return _impl_.config_.size();
+}
+inline int QueryResponse::config_size() const {
+  return _internal_config_size();
+}
+inline void QueryResponse::clear_config() {
+  _impl_.config_.Clear();
+}
+inline ::ConfigEntry* QueryResponse::mutable_config(int index) {
+  // @@protoc_insertion_point(field_mutable:QueryResponse.config)
+  return _impl_.config_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ConfigEntry >*
+QueryResponse::mutable_config() {
+  // @@protoc_insertion_point(field_mutable_list:QueryResponse.config)
+  return &_impl_.config_;
+}
+inline const ::ConfigEntry& QueryResponse::_internal_config(int index) const {
+  return _impl_.config_.Get(index);
+}
+inline const ::ConfigEntry& QueryResponse::config(int index) const {
+  // @@protoc_insertion_point(field_get:QueryResponse.config)
+  return _internal_config(index);
+}
+inline ::ConfigEntry* QueryResponse::_internal_add_config() {
+  return _impl_.config_.Add();
+}
+inline ::ConfigEntry* QueryResponse::add_config() {
+  ::ConfigEntry* _add = _internal_add_config();
+  // @@protoc_insertion_point(field_add:QueryResponse.config)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ConfigEntry >&
+QueryResponse::config() const {
+  // @@protoc_insertion_point(field_list:QueryResponse.config)
+  return _impl_.config_;
+}
+
+// -------------------------------------------------------------------
+
+// GDPRDeleteRequest
+
+// string key = 1;
+inline void GDPRDeleteRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GDPRDeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:GDPRDeleteRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GDPRDeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GDPRDeleteRequest.key)
+}
+inline std::string* GDPRDeleteRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:GDPRDeleteRequest.key)
+  return _s;
+}
+inline const std::string& GDPRDeleteRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GDPRDeleteRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GDPRDeleteRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GDPRDeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:GDPRDeleteRequest.key)
+  return _impl_.key_.Release();
+}
+inline void GDPRDeleteRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GDPRDeleteRequest.key)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_shardmaster_2eproto
@@ -2,6 +2,7 @@
 // Created by raghu on 12/23/19.
 //
 
+#include <cstdio>
 #include <iostream>
 
 #include "client.h"
@@ -187,6 +188,37 @@ void Client::Append(const std::string &key, const std::string &value) {
     }
 }
 
+void Client::Stats(const std::string& addr) {
+    Empty req;
+    StatsResponse res;
+    ClientContext cc;
+
+    Status status;
+    if (addr.empty()) {
+        status = stub->Stats(&cc, req, &res);
+    } else {
+        auto kvStub = Shardkv::NewStub(grpc::CreateChannel(addr, grpc::InsecureChannelCredentials()));
+        status = kvStub->Stats(&cc, req, &res);
+    }
+    if(!status.ok()) {
+        logError("Stats", status);
+        return;
+    }
+    printf("%-10s %10s %8s %10s %10s %10s %10s %10s\n", "method", "calls", "errors", "p50 us", "p99 us", "p999 us",
+           "max us", "mean us");
+    for (const auto& method : res.methods()) {
+        printf("%-10s %10lu %8lu %10lu %10lu %10lu %10lu %10.1f\n", method.method().c_str(),
+               (unsigned long)method.calls(), (unsigned long)method.errors(), (unsigned long)method.p50_us(),
+               (unsigned long)method.p99_us(), (unsigned long)method.p999_us(), (unsigned long)method.max_us(),
+               method.mean_us());
+    }
+    for (const auto& shard : res.shards()) {
+        printf("shard [%u, %u]: %lu requests\n", shard.shard().lower(), shard.shard().upper(),
+               (unsigned long)shard.requests());
+    }
+    fflush(stdout);
+}
+
 // helper for getting key-value server stubs given a key. returns nullptr on error
 std::unique_ptr<Shardkv::Stub> Client::getKVStub(const std::string key) {
     // get servername
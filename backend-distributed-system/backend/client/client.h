@@ -42,6 +42,9 @@ public:
 
     void Delete(const std::string& key);
 
+    // prints the Stats of the shardmaster, or of the server at addr
+    void Stats(const std::string& addr);
+
 private:
     // helper for getting stubs to shardkv servers given a key
     std::unique_ptr<Shardkv::Stub> getKVStub(const std::string key);
@@ -15,6 +15,7 @@
 #include "appendcommand.h"
 #include "putcommand.h"
 #include "deletecommand.h"
+#include "statscommand.h"
 
 using namespace std;
 
@@ -47,6 +48,8 @@ int main(int argc, char **argv) {
     repl.AddCommand(ac);
     DeleteCommand dc(client);
     repl.AddCommand(dc);
+    StatsCommand sc(client);
+    repl.AddCommand(sc);
 
     // now start repl
     repl.Start();
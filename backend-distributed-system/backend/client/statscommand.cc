@@ -0,0 +1,14 @@
+#include "statscommand.h"
+
+using namespace std;
+
+void StatsCommand::Handle(const string &line) {
+    vector<string> tokens = split(line);
+    client.Stats(tokens.size() > 1 ? tokens[1] : "");
+}
+
+void StatsCommand::PrintHelpMessage() {
+    cout << "stats [<addr>]\nprints the calls, errors and latency percentiles of every method of the shardmaster, "
+            "or of the shardmanager or key-value server running on <addr>, and the requests per shard of a "
+            "key-value server\n";
+}
@@ -0,0 +1,18 @@
+#ifndef SHARDING_STATSCOMMAND_H
+#define SHARDING_STATSCOMMAND_H
+
+
+#include "../repl/regexcommand.h"
+#include "client.h"
+
+class StatsCommand : public RegexCommand {
+public:
+    explicit StatsCommand(Client& cl) : RegexCommand("stats( .*:\\d+)?"), client(cl) {}
+    void Handle(const std::string& line) override;
+    void PrintHelpMessage() override;
+private:
+    Client& client;
+};
+
+
+#endif //SHARDING_STATSCOMMAND_H
@@ -0,0 +1,50 @@
+#include "channel_pool.h"
+
+#include <mutex>
+
+ChannelPool::ChannelPool(size_t connections_per_address)
+    : connections_per_address(connections_per_address > 0 ? connections_per_address : 1) {}
+
+std::shared_ptr<grpc::Channel> ChannelPool::Get(const std::string& address) {
+    std::shared_ptr<Connections> conns;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = connections.find(address);
+        if (it != connections.end()) {
+            conns = it->second;
+        }
+    }
+    if (!conns) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto& entry = connections[address];
+        if (!entry) {
+            entry = connect(address);
+        }
+        conns = entry;
+    }
+    size_t i = conns->next.fetch_add(1, std::memory_order_relaxed);
+    return conns->channels[i % conns->channels.size()];
+}
+
+void ChannelPool::Refresh(const std::string& address) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    connections.erase(address);
+}
+
+std::shared_ptr<ChannelPool::Connections> ChannelPool::connect(const std::string& address) const {
+    auto conns = std::make_shared<Connections>();
+    for (size_t i = 0; i < connections_per_address; i++) {
+        grpc::ChannelArguments args;
+        // channels with different args don't share subchannels, and a local
+        // subchannel pool keeps them off the process-wide one, so each of these
+        // gets a connection of its own
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        args.SetInt("sharding.connection_index", static_cast<int>(i));
+        auto channel = grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+        // start resolving and connecting now rather than on the first call, so
+        // that call's deadline isn't spent on the handshake
+        channel->GetState(true);
+        conns->channels.push_back(channel);
+    }
+    return conns;
+}
@@ -0,0 +1,40 @@
+#ifndef SHARDING_CHANNEL_POOL_H
+#define SHARDING_CHANNEL_POOL_H
+
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Channels to other servers, created on first use and kept until Refresh().
+// Building a channel per RPC costs a TCP and HTTP/2 handshake every time; a
+// cached channel reuses its connection and reconnects by itself if it drops.
+// Each address can get several channels, each on its own connection, handed
+// out round robin so a busy backend isn't limited by the streams of a single
+// HTTP/2 connection. Safe to use from any thread.
+class ChannelPool {
+public:
+    explicit ChannelPool(size_t connections_per_address = 1);
+
+    std::shared_ptr<grpc::Channel> Get(const std::string& address);
+    // forgets the channels to address (in-flight calls on them still finish),
+    // the next Get connects again
+    void Refresh(const std::string& address);
+
+private:
+    struct Connections {
+        std::vector<std::shared_ptr<grpc::Channel>> channels;
+        std::atomic<size_t> next{0};
+    };
+
+    std::shared_ptr<Connections> connect(const std::string& address) const;
+
+    const size_t connections_per_address;
+    std::shared_mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<Connections>> connections;
+};
+
+#endif  // SHARDING_CHANNEL_POOL_H
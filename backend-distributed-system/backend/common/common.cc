@@ -1,4 +1,5 @@
 #include "common.h"
+#include "log.h"
 #include <algorithm>
 #include <cassert>
 #include <regex>
@@ -159,6 +160,6 @@ void resizeShards(const std::vector<std::string>& server_list,
 }
 void logError(const std::string& method, Status& error) {
     assert(!error.ok());
-    std::cerr << "method " << method << " failed with status code "
-              << error.error_code() << "\nthe error message was: " << error.error_message() << "\n";
+    LOG_ERROR << "method " << method << " failed with status code " << error.error_code()
+              << "\nthe error message was: " << error.error_message();
 }
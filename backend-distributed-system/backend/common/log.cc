@@ -0,0 +1,208 @@
+#include "log.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// how often the writer drains the rings
+constexpr std::chrono::milliseconds LOG_FLUSH_INTERVAL(10);
+// lines a thread can have queued, and the longest line kept (the rest is cut)
+constexpr size_t LOG_RING_RECORDS = 256;
+constexpr size_t LOG_RECORD_BYTES = 512;
+
+namespace {
+
+struct LogRecord {
+    std::chrono::system_clock::time_point time;
+    LogLevel level;
+    size_t size;
+    char text[LOG_RECORD_BYTES];
+};
+
+// A thread's queued lines. Only the thread pushes and only the writer drains,
+// so head and tail are all the synchronization needed.
+class LogRing {
+public:
+    void Push(LogLevel level, const std::string& text) {
+        size_t head_now = head.load(std::memory_order_relaxed);
+        if (head_now - tail.load(std::memory_order_acquire) == LOG_RING_RECORDS) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        LogRecord& record = records[head_now % LOG_RING_RECORDS];
+        record.time = std::chrono::system_clock::now();
+        record.level = level;
+        record.size = std::min(text.size(), LOG_RECORD_BYTES);
+        memcpy(record.text, text.data(), record.size);
+        head.store(head_now + 1, std::memory_order_release);
+    }
+
+    template <typename Fn>
+    void Drain(Fn&& fn) {
+        size_t tail_now = tail.load(std::memory_order_relaxed);
+        size_t head_now = head.load(std::memory_order_acquire);
+        for (; tail_now != head_now; tail_now++) {
+            fn(records[tail_now % LOG_RING_RECORDS]);
+        }
+        tail.store(tail_now, std::memory_order_release);
+    }
+
+    bool Empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+    }
+
+    uint64_t TakeDropped() {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::array<LogRecord, LOG_RING_RECORDS> records;
+    // head is only written by the thread, tail only by the writer
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+};
+
+struct Logger {
+    // guards rings and writer_started, and keeps drains from overlapping
+    std::mutex mutex;
+    std::vector<std::shared_ptr<LogRing>> rings;
+    bool writer_started = false;
+    // bumped in a forked child: the rings it inherited belong to the parent
+    std::atomic<uint64_t> generation{0};
+};
+
+// never destroyed, threads may log until the process is gone
+Logger& logger() {
+    static Logger* instance = new Logger;
+    return *instance;
+}
+
+struct ThreadRing {
+    std::shared_ptr<LogRing> ring;
+    uint64_t generation = 0;
+};
+thread_local ThreadRing thread_ring;
+
+const char LEVEL_LETTERS[] = {'D', 'I', 'W', 'E'};
+
+// writes out what the rings hold and forgets the rings of threads that are
+// gone. Call with the logger's mutex held.
+void drain(Logger& log) {
+    struct Line {
+        std::chrono::system_clock::time_point time;
+        LogLevel level;
+        std::string text;
+    };
+    std::vector<Line> lines;
+    uint64_t dropped = 0;
+    for (const auto& ring : log.rings) {
+        ring->Drain([&lines](const LogRecord& record) {
+            lines.push_back({record.time, record.level, std::string(record.text, record.size)});
+        });
+        dropped += ring->TakeDropped();
+    }
+    // a thread shares its ring with us until it exits; after that, nothing
+    // more comes in and the ring can go once it is empty
+    log.rings.erase(std::remove_if(log.rings.begin(), log.rings.end(),
+                                   [](const std::shared_ptr<LogRing>& ring) {
+                                       return ring.use_count() == 1 && ring->Empty();
+                                   }),
+                    log.rings.end());
+
+    std::stable_sort(lines.begin(), lines.end(), [](const Line& a, const Line& b) { return a.time < b.time; });
+    for (const Line& line : lines) {
+        auto since_epoch = line.time.time_since_epoch();
+        time_t seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch).count();
+        long millis = std::chrono::duration_cast<std::chrono::milliseconds>(since_epoch).count() % 1000;
+        struct tm local;
+        localtime_r(&seconds, &local);
+        FILE* out = line.level >= LogLevel::WARNING ? stderr : stdout;
+        fprintf(out, "%c %02d:%02d:%02d.%03ld %s\n", LEVEL_LETTERS[static_cast<int>(line.level)], local.tm_hour,
+                local.tm_min, local.tm_sec, millis, line.text.c_str());
+    }
+    if (dropped > 0) {
+        fprintf(stderr, "W logger: dropped %lu lines, the threads logged faster than they were written out\n",
+                static_cast<unsigned long>(dropped));
+    }
+    if (!lines.empty() || dropped > 0) {
+        fflush(stdout);
+        fflush(stderr);
+    }
+}
+
+// the writer is not carried over by fork, and the child gets a copy of the
+// rings the parent is still to write out
+void forkPrepare() {
+    logger().mutex.lock();
+}
+void forkParent() {
+    logger().mutex.unlock();
+}
+void forkChild() {
+    Logger& log = logger();
+    log.rings.clear();
+    log.writer_started = false;
+    log.generation++;
+    log.mutex.unlock();
+}
+
+// Call with the logger's mutex held.
+void startWriter(Logger& log) {
+    if (log.writer_started) {
+        return;
+    }
+    log.writer_started = true;
+    static std::once_flag hooks;
+    std::call_once(hooks, []() {
+        std::atexit(FlushLog);
+        pthread_atfork(forkPrepare, forkParent, forkChild);
+    });
+    std::thread writer([]() {
+        while (true) {
+            std::this_thread::sleep_for(LOG_FLUSH_INTERVAL);
+            Logger& log = logger();
+            std::lock_guard<std::mutex> lock(log.mutex);
+            drain(log);
+        }
+    });
+    // we detach the thread so we don't have to wait for it to terminate later
+    writer.detach();
+}
+
+LogRing& threadRing() {
+    Logger& log = logger();
+    uint64_t generation = log.generation.load();
+    if (!thread_ring.ring || thread_ring.generation != generation) {
+        thread_ring.ring = std::make_shared<LogRing>();
+        thread_ring.generation = generation;
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.rings.push_back(thread_ring.ring);
+        startWriter(log);
+    }
+    return *thread_ring.ring;
+}
+
+}  // namespace
+
+LogLine::~LogLine() {
+    threadRing().Push(level, out.str());
+}
+
+void FlushLog() {
+    Logger& log = logger();
+    std::lock_guard<std::mutex> lock(log.mutex);
+    drain(log);
+}
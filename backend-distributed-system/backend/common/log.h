@@ -0,0 +1,63 @@
+#ifndef SHARDING_LOG_H
+#define SHARDING_LOG_H
+
+#include <sstream>
+#include <string>
+#include <utility>
+
+// Leveled, asynchronous logging:
+//
+//     LOG_INFO << "copied " << users << " users from " << primary;
+//
+// A line is formatted on the calling thread and queued on a ring that only
+// that thread writes to. A background thread drains every thread's ring each
+// LOG_FLUSH_INTERVAL and writes the lines out in time order, debug and info to
+// stdout, warnings and errors to stderr. Logging thus never waits on the
+// output streams or on another thread; a thread whose ring is full drops the
+// line instead, and the writer reports how many were dropped.
+//
+// Levels below LOG_LEVEL are compiled out, arguments and all. The default
+// leaves out debug lines, build with LOG_LEVEL=0 to have them.
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 1
+#endif
+
+enum class LogLevel { DEBUG = 0, INFO = 1, WARNING = 2, ERROR = 3 };
+
+constexpr bool logEnabled(LogLevel level) {
+    return static_cast<int>(level) >= LOG_LEVEL;
+}
+
+// one line, queued when it goes out of scope at the end of the statement
+class LogLine {
+public:
+    explicit LogLine(LogLevel level) : level(level) {}
+    ~LogLine();
+
+    template <typename T>
+    LogLine& operator<<(T&& value) {
+        out << std::forward<T>(value);
+        return *this;
+    }
+
+private:
+    LogLevel level;
+    std::ostringstream out;
+};
+
+// the else keeps the macro a single statement, and for a level below
+// LOG_LEVEL it is dead code the compiler drops
+#define LOG_AT(level) \
+    if (!logEnabled(level)) { \
+    } else \
+        LogLine(level)
+#define LOG_DEBUG LOG_AT(LogLevel::DEBUG)
+#define LOG_INFO LOG_AT(LogLevel::INFO)
+#define LOG_WARNING LOG_AT(LogLevel::WARNING)
+#define LOG_ERROR LOG_AT(LogLevel::ERROR)
+
+// writes out everything queued so far, from every thread. Runs at exit too.
+void FlushLog();
+
+#endif  // SHARDING_LOG_H
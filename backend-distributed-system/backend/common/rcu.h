@@ -0,0 +1,105 @@
+#ifndef SHARDING_RCU_H
+#define SHARDING_RCU_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// A pointer to an immutable object that is read without locks and replaced
+// RCU-style. Readers pin the current version with Read(), which costs two
+// uncontended atomic increments and never waits. Publish() swaps in a new
+// version and only frees the old one after every reader that could still see
+// it has dropped its guard (a grace period over two reader epochs).
+//
+// Meant for read-mostly state such as the shard ownership of a server: the
+// request path reads it on every RPC while a background thread replaces it
+// when the configuration changes.
+template <typename T>
+class RcuPtr {
+    // reader counters are spread over a few cache lines so concurrent readers
+    // don't all bounce the same one
+    static constexpr size_t NUM_SLOTS = 16;
+    struct alignas(64) Slot {
+        std::atomic<long> readers[2] = {{0}, {0}};
+    };
+
+public:
+    // keeps one version alive for as long as it exists
+    class ReadGuard {
+    public:
+        ReadGuard(ReadGuard&& other) noexcept : counter(other.counter), ptr(other.ptr) {
+            other.counter = nullptr;
+        }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ~ReadGuard() {
+            if (counter) {
+                counter->fetch_sub(1);
+            }
+        }
+
+        const T* get() const { return ptr; }
+        const T* operator->() const { return ptr; }
+        const T& operator*() const { return *ptr; }
+        explicit operator bool() const { return ptr != nullptr; }
+
+    private:
+        friend class RcuPtr;
+        ReadGuard(std::atomic<long>* counter, const T* ptr) : counter(counter), ptr(ptr) {}
+
+        std::atomic<long>* counter;
+        const T* ptr;
+    };
+
+    RcuPtr() = default;
+    explicit RcuPtr(std::unique_ptr<const T> initial) : current(initial.release()) {}
+    RcuPtr(const RcuPtr&) = delete;
+    RcuPtr& operator=(const RcuPtr&) = delete;
+    ~RcuPtr() { delete current.load(); }
+
+    ReadGuard Read() const {
+        unsigned int epoch_now = epoch.load();
+        std::atomic<long>* counter = &slots[slotIndex()].readers[epoch_now & 1];
+        // announce ourselves before loading the pointer, so a writer that swaps
+        // it after this point waits for us before freeing what we load
+        counter->fetch_add(1);
+        return ReadGuard(counter, current.load());
+    }
+
+    // replaces the current version. Blocks the caller (never the readers) until
+    // the previous version can be freed.
+    void Publish(std::unique_ptr<const T> next) {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        const T* old = current.exchange(next.release());
+        synchronize();
+        delete old;
+    }
+
+private:
+    static size_t slotIndex() {
+        static std::atomic<size_t> next_slot{0};
+        thread_local size_t slot = next_slot.fetch_add(1) % NUM_SLOTS;
+        return slot;
+    }
+
+    // waits until every reader that started before the call has finished.
+    // Readers may have sampled either parity of the epoch, so both are drained.
+    void synchronize() {
+        for (int flip = 0; flip < 2; flip++) {
+            unsigned int parity = epoch.fetch_add(1) & 1;
+            for (size_t i = 0; i < NUM_SLOTS; i++) {
+                while (slots[i].readers[parity].load() != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    std::atomic<const T*> current{nullptr};
+    std::atomic<unsigned int> epoch{0};
+    mutable Slot slots[NUM_SLOTS];
+    std::mutex writer_mutex;
+};
+
+#endif  // SHARDING_RCU_H
@@ -0,0 +1,136 @@
+#include "rpc_stats.h"
+
+#include <algorithm>
+
+#include "../build/shardmaster.pb.h"
+
+namespace {
+
+// the stripe of the calling thread: threads are numbered as they first
+// record something
+size_t threadStripe() {
+    static std::atomic<size_t> next_thread{0};
+    thread_local size_t stripe = next_thread.fetch_add(1, std::memory_order_relaxed) % STATS_STRIPES;
+    return stripe;
+}
+
+// position of the highest bit set, v > 0
+unsigned highestBit(uint64_t v) {
+    return 63 - __builtin_clzll(v);
+}
+
+}  // namespace
+
+size_t LatencyHistogram::BucketOf(uint64_t micros) {
+    constexpr uint64_t sub_buckets = 1 << HISTOGRAM_SUB_BITS;
+    micros = std::min<uint64_t>(micros, (uint64_t(1) << HISTOGRAM_MAX_BITS) - 1);
+    if (micros < sub_buckets) {
+        return micros;
+    }
+    // the values with the highest bit at HISTOGRAM_SUB_BITS + shift are split
+    // in sub_buckets buckets of 2^shift each
+    unsigned shift = highestBit(micros) - HISTOGRAM_SUB_BITS;
+    return (shift + 1) * sub_buckets + (micros >> shift) - sub_buckets;
+}
+
+uint64_t LatencyHistogram::BucketMax(size_t bucket) {
+    constexpr uint64_t sub_buckets = 1 << HISTOGRAM_SUB_BITS;
+    if (bucket < sub_buckets) {
+        return bucket;
+    }
+    unsigned shift = bucket / sub_buckets - 1;
+    uint64_t lowest = (sub_buckets + bucket % sub_buckets) << shift;
+    return lowest + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::Add(size_t bucket, uint64_t n) {
+    buckets[bucket] += n;
+    count += n;
+}
+
+uint64_t LatencyHistogram::Percentile(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    // the rank of the call we are after, counting from 1
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * count + 0.5));
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return BucketMax(bucket);
+        }
+    }
+    return BucketMax(HISTOGRAM_BUCKETS - 1);
+}
+
+RpcStats::RpcStats(std::vector<std::string> methods, size_t keys)
+    : methods(std::move(methods)),
+      keys(keys),
+      stripe_lines((keyBase() + keys + 7) / 8),
+      lines(new CacheLine[STATS_STRIPES * stripe_lines]()) {}
+
+std::atomic<uint64_t>& RpcStats::counter(size_t stripe, size_t index) const {
+    return lines[stripe * stripe_lines + index / 8].counters[index % 8];
+}
+
+uint64_t RpcStats::sum(size_t index) const {
+    uint64_t total = 0;
+    for (size_t stripe = 0; stripe < STATS_STRIPES; stripe++) {
+        total += counter(stripe, index).load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void RpcStats::Record(size_t method, std::chrono::steady_clock::duration latency, bool ok) {
+    size_t stripe = threadStripe();
+    uint64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    counter(stripe, methodBase(method) + LatencyHistogram::BucketOf(micros)).fetch_add(1, std::memory_order_relaxed);
+    if (!ok) {
+        counter(stripe, errorsOf(method)).fetch_add(1, std::memory_order_relaxed);
+    }
+    counter(stripe, totalOf(method)).fetch_add(micros, std::memory_order_relaxed);
+    std::atomic<uint64_t>& max = counter(stripe, maxOf(method));
+    uint64_t seen = max.load(std::memory_order_relaxed);
+    while (micros > seen && !max.compare_exchange_weak(seen, micros, std::memory_order_relaxed)) {
+    }
+}
+
+void RpcStats::CountKey(unsigned int key) {
+    if (key < keys) {
+        counter(threadStripe(), keyBase() + key).fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RpcStats::Fill(StatsResponse* response, const std::vector<shard_t>& shards) const {
+    for (size_t method = 0; method < methods.size(); method++) {
+        LatencyHistogram histogram;
+        for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+            histogram.Add(bucket, sum(methodBase(method) + bucket));
+        }
+        uint64_t max = 0;
+        for (size_t stripe = 0; stripe < STATS_STRIPES; stripe++) {
+            max = std::max(max, counter(stripe, maxOf(method)).load(std::memory_order_relaxed));
+        }
+        MethodStats* stats = response->add_methods();
+        stats->set_method(methods[method]);
+        stats->set_calls(histogram.Count());
+        stats->set_errors(sum(errorsOf(method)));
+        // a bucket's upper end can be past the largest call in it
+        stats->set_p50_us(std::min(max, histogram.Percentile(0.5)));
+        stats->set_p99_us(std::min(max, histogram.Percentile(0.99)));
+        stats->set_p999_us(std::min(max, histogram.Percentile(0.999)));
+        stats->set_max_us(max);
+        stats->set_mean_us(histogram.Count() ? static_cast<double>(sum(totalOf(method))) / histogram.Count() : 0);
+    }
+    for (const shard_t& shard : shards) {
+        uint64_t requests = 0;
+        for (uint64_t key = shard.lower; key <= shard.upper && key < keys; key++) {
+            requests += sum(keyBase() + key);
+        }
+        ShardStats* stats = response->add_shards();
+        stats->mutable_shard()->set_lower(shard.lower);
+        stats->mutable_shard()->set_upper(shard.upper);
+        stats->set_requests(requests);
+    }
+}
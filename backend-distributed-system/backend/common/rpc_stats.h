@@ -0,0 +1,102 @@
+#ifndef SHARDING_RPC_STATS_H
+#define SHARDING_RPC_STATS_H
+
+#include <grpcpp/grpcpp.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+class StatsResponse;
+
+// HDR-style latency histogram, in microseconds. A value goes to a bucket by
+// its top HISTOGRAM_SUB_BITS + 1 bits, so at any magnitude a bucket spans at
+// most 1/16 (6%) of the values in it, from 1 us up to 2^32 us (71 minutes),
+// in 464 buckets.
+constexpr unsigned HISTOGRAM_SUB_BITS = 4;
+constexpr unsigned HISTOGRAM_MAX_BITS = 32;
+constexpr size_t HISTOGRAM_BUCKETS = (HISTOGRAM_MAX_BITS - HISTOGRAM_SUB_BITS + 1) << HISTOGRAM_SUB_BITS;
+
+class LatencyHistogram {
+public:
+    static size_t BucketOf(uint64_t micros);
+    // the largest value that lands in bucket
+    static uint64_t BucketMax(size_t bucket);
+
+    void Add(size_t bucket, uint64_t count);
+    uint64_t Count() const { return count; }
+    // an upper bound of the value at that fraction of the calls (0.99 for the
+    // p99), within the bucket width
+    uint64_t Percentile(double fraction) const;
+
+private:
+    std::array<uint64_t, HISTOGRAM_BUCKETS> buckets{};
+    uint64_t count = 0;
+};
+
+// stripes the counters are spread over; a thread always uses the same one
+constexpr size_t STATS_STRIPES = 16;
+
+// Per-method call counts, errors and latency histograms of one service, and
+// request counts per key. Threads count into their own stripe of counters,
+// each stripe on cache lines of its own, so that recording a call is a few
+// uncontended atomic adds; Fill sums the stripes up when somebody asks.
+class RpcStats {
+public:
+    // methods are referred to by their index in methods. Counting keys needs
+    // keys > 0: one counter per key from MIN_KEY to keys - 1.
+    explicit RpcStats(std::vector<std::string> methods, size_t keys = 0);
+
+    void Record(size_t method, std::chrono::steady_clock::duration latency, bool ok);
+    void CountKey(unsigned int key);
+
+    // the methods' latencies, and the requests to each of shards
+    void Fill(StatsResponse* response, const std::vector<shard_t>& shards = {}) const;
+
+private:
+    struct alignas(64) CacheLine {
+        std::atomic<uint64_t> counters[8];
+    };
+
+    std::atomic<uint64_t>& counter(size_t stripe, size_t index) const;
+    uint64_t sum(size_t index) const;
+
+    // a stripe holds, per method, its histogram, errors, total and max
+    // latency, then the key counters
+    size_t methodBase(size_t method) const { return method * (HISTOGRAM_BUCKETS + 3); }
+    size_t errorsOf(size_t method) const { return methodBase(method) + HISTOGRAM_BUCKETS; }
+    size_t totalOf(size_t method) const { return methodBase(method) + HISTOGRAM_BUCKETS + 1; }
+    size_t maxOf(size_t method) const { return methodBase(method) + HISTOGRAM_BUCKETS + 2; }
+    size_t keyBase() const { return methodBase(methods.size()); }
+
+    const std::vector<std::string> methods;
+    const size_t keys;
+    // cache lines per stripe
+    const size_t stripe_lines;
+    std::unique_ptr<CacheLine[]> lines;
+};
+
+// Times one call of a handler; return timer.Done(status) records it.
+class RpcTimer {
+public:
+    RpcTimer(RpcStats& stats, size_t method)
+        : stats(stats), method(method), start(std::chrono::steady_clock::now()) {}
+
+    ::grpc::Status Done(::grpc::Status status) {
+        stats.Record(method, std::chrono::steady_clock::now() - start, status.ok());
+        return status;
+    }
+
+private:
+    RpcStats& stats;
+    size_t method;
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif  // SHARDING_RPC_STATS_H
@@ -13,4 +13,5 @@ mkdir client_dir
 mkdir repl_dir
 mkdir test_utils
 mkdir fault_tolerance_tests
+mkdir benchmarks
 cd ..
@@ -0,0 +1,424 @@
+#include "kvstore.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "replication_log.h"
+#include "snapshot.h"
+
+KvStore::KvStore(size_t num_stripes)
+    : num_stripes(num_stripes),
+      user_stripes(new UserStripe[num_stripes]),
+      post_stripes(new PostStripe[num_stripes]) {}
+
+KvStore::UserStripe& KvStore::userStripe(const std::string& key) const {
+    return user_stripes[std::hash<std::string>{}(key) % num_stripes];
+}
+
+KvStore::PostStripe& KvStore::postStripe(const std::string& key) const {
+    return post_stripes[std::hash<std::string>{}(key) % num_stripes];
+}
+
+void KvStore::PutUser(const std::string& key, const std::string& value, bool sync) {
+    UserStripe& stripe = userStripe(key);
+    Logged logged;
+    {
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        stripe.users.Put(key, value, clock, newest_view);
+        logged = logChange({WalRecord::Type::PUT_USER, key, value, ""});
+    }
+    waitDurable(logged, sync);
+}
+
+bool KvStore::GetUser(const std::string& key, std::string* value) const {
+    UserStripe& stripe = userStripe(key);
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+    const std::string* name = stripe.users.Find(key);
+    if (name == nullptr) {
+        return false;
+    }
+    *value = *name;
+    return true;
+}
+
+bool KvStore::DeleteUser(const std::string& key, bool sync) {
+    UserStripe& stripe = userStripe(key);
+    Logged logged;
+    {
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        if (!stripe.users.Erase(key, clock, newest_view)) {
+            return false;
+        }
+        logged = logChange({WalRecord::Type::DELETE_USER, key, "", ""});
+    }
+    waitDurable(logged, sync);
+    return true;
+}
+
+void KvStore::PutPost(const std::string& key, const post_t& post, bool sync) {
+    PostStripe& stripe = postStripe(key);
+    Logged logged;
+    {
+        // held across the index update so two writers of the same post can't
+        // leave it indexed under the wrong user
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        const post_t* old = stripe.posts.Find(key);
+        if (old != nullptr && old->user_id != post.user_id) {
+            // the post is re-attributed to another user
+            UserStripe& old_user = userStripe(old->user_id);
+            std::unique_lock<std::shared_mutex> user_lock(old_user.mutex);
+            old_user.user_posts.Remove(old->user_id, key);
+        }
+        stripe.posts.Put(key, post, clock, newest_view);
+        {
+            UserStripe& user = userStripe(post.user_id);
+            std::unique_lock<std::shared_mutex> user_lock(user.mutex);
+            user.user_posts.Add(post.user_id, key);
+        }
+        logged = logChange({WalRecord::Type::PUT_POST, key, post.content, post.user_id});
+    }
+    waitDurable(logged, sync);
+}
+
+bool KvStore::GetPost(const std::string& key, post_t* post) const {
+    PostStripe& stripe = postStripe(key);
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+    const post_t* found = stripe.posts.Find(key);
+    if (found == nullptr) {
+        return false;
+    }
+    *post = *found;
+    return true;
+}
+
+bool KvStore::DeletePost(const std::string& key, bool sync) {
+    PostStripe& stripe = postStripe(key);
+    Logged logged;
+    {
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        const post_t* post = stripe.posts.Find(key);
+        if (post == nullptr) {
+            return false;
+        }
+        UserStripe& user = userStripe(post->user_id);
+        {
+            std::unique_lock<std::shared_mutex> user_lock(user.mutex);
+            user.user_posts.Remove(post->user_id, key);
+        }
+        stripe.posts.Erase(key, clock, newest_view);
+        logged = logChange({WalRecord::Type::DELETE_POST, key, "", ""});
+    }
+    waitDurable(logged, sync);
+    return true;
+}
+
+void KvStore::SetLog(WriteAheadLog* log) {
+    this->log = log;
+}
+
+void KvStore::SetReplication(ReplicationLog* replication) {
+    this->replication = replication;
+}
+
+void KvStore::Sync() {
+    waitDurable({log != nullptr ? log->LastSeq() : 0, replication != nullptr ? replication->LastSeq() : 0}, true);
+}
+
+void KvStore::Apply(const WalRecord& record, bool sync) {
+    switch (record.type) {
+        case WalRecord::Type::PUT_USER:
+            PutUser(record.key, record.value, sync);
+            break;
+        case WalRecord::Type::PUT_POST:
+            PutPost(record.key, {record.user, record.value}, sync);
+            break;
+        case WalRecord::Type::DELETE_USER:
+            DeleteUser(record.key, sync);
+            break;
+        case WalRecord::Type::DELETE_POST:
+            DeletePost(record.key, sync);
+            break;
+    }
+}
+
+KvStore::Logged KvStore::logChange(const WalRecord& record) {
+    return {log != nullptr ? log->Append(record) : 0, replication != nullptr ? replication->Append(record) : 0};
+}
+
+void KvStore::waitDurable(const Logged& logged, bool sync) {
+    if (!sync) {
+        return;
+    }
+    // the backup gets the change meanwhile, so the two waits overlap
+    if (logged.log_seq != 0) {
+        log->Sync(logged.log_seq);
+    }
+    if (logged.replication_seq != 0) {
+        replication->WaitAcked(logged.replication_seq);
+    }
+}
+
+std::string KvStore::UserPosts(const std::string& user) const {
+    UserStripe& stripe = userStripe(user);
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+    return stripe.user_posts.Posts(user);
+}
+
+std::vector<std::string> KvStore::UserKeys() const {
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < num_stripes; i++) {
+        std::shared_lock<std::shared_mutex> lock(user_stripes[i].mutex);
+        user_stripes[i].users.ForEach(
+                [&keys](const std::string& key, const std::string&) { keys.push_back(key); });
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+std::shared_ptr<const KvStore::View> KvStore::Freeze() const {
+    std::lock_guard<std::mutex> views_lock(views_mutex);
+    // same order as the writers: every post stripe, then every user stripe
+    std::vector<std::unique_lock<std::shared_mutex>> locks;
+    locks.reserve(2 * num_stripes);
+    for (size_t i = 0; i < num_stripes; i++) {
+        locks.emplace_back(post_stripes[i].mutex);
+    }
+    for (size_t i = 0; i < num_stripes; i++) {
+        locks.emplace_back(user_stripes[i].mutex);
+    }
+    uint64_t version = clock++;
+    open_views.insert(version);
+    newest_view = version;
+    return std::shared_ptr<const View>(new View(this, version));
+}
+
+void KvStore::release(uint64_t version) const {
+    // held throughout, so that a view frozen meanwhile can't lose the values
+    // written for it to a prune that didn't know about it
+    std::lock_guard<std::mutex> views_lock(views_mutex);
+    open_views.erase(open_views.find(version));
+    newest_view = open_views.empty() ? 0 : *open_views.rbegin();
+    for (size_t i = 0; i < num_stripes; i++) {
+        VersionedTable<std::string>::History old_users;
+        VersionedTable<post_t>::History old_posts;
+        {
+            std::unique_lock<std::shared_mutex> lock(user_stripes[i].mutex);
+            if (open_views.empty()) {
+                old_users = user_stripes[i].users.TakeHistory();
+            } else {
+                user_stripes[i].users.Prune(open_views);
+            }
+        }
+        {
+            std::unique_lock<std::shared_mutex> lock(post_stripes[i].mutex);
+            if (open_views.empty()) {
+                old_posts = post_stripes[i].posts.TakeHistory();
+            } else {
+                post_stripes[i].posts.Prune(open_views);
+            }
+        }
+        // the old values are freed here, with no stripe locked
+    }
+}
+
+KvStore::View::View(const KvStore* store, uint64_t version) : store(store), version(version) {}
+
+KvStore::View::~View() {
+    store->release(version);
+}
+
+namespace {
+
+// entries read from a stripe per lock hold
+constexpr size_t REFILL = 16;
+
+size_t entrySize(const std::pair<std::string, std::string>& user) {
+    return user.first.size() + user.second.size();
+}
+
+size_t entrySize(const std::pair<std::string, post_t>& post) {
+    return post.first.size() + post.second.user_id.size() + post.second.content.size();
+}
+
+// Calls fn on every entry of the tables seen at version `at`, REFILL entries
+// of a stripe at a time, without holding a lock while fn runs.
+template <typename Stripe, typename Value, typename Fn>
+void forEachAt(const Stripe* stripes, size_t num_stripes, VersionedTable<Value> Stripe::*table, uint64_t at,
+               Fn fn) {
+    std::vector<std::pair<std::string, Value>> entries;
+    for (size_t i = 0; i < num_stripes; i++) {
+        std::string from;
+        bool done = false;
+        while (!done) {
+            entries.clear();
+            {
+                std::shared_lock<std::shared_mutex> lock(stripes[i].mutex);
+                done = (stripes[i].*table).VisibleAfter(from, at, REFILL, &entries);
+            }
+            for (const auto& entry : entries) {
+                fn(entry.first, entry.second);
+            }
+            if (!entries.empty()) {
+                from = entries.back().first;
+            }
+        }
+    }
+}
+
+// Merges the stripes in key order, as seen at version `at`. Each stripe is
+// read a few entries at a time under its lock, so a page costs about its own
+// size in copies whatever the number of stripes, and no lock is held while
+// merging.
+template <typename Stripe, typename Value>
+std::vector<std::pair<std::string, Value>> pageAfter(const Stripe* stripes, size_t num_stripes,
+                                                      VersionedTable<Value> Stripe::*table, uint64_t at,
+                                                      const std::string& after, size_t max_bytes) {
+    struct Source {
+        std::vector<std::pair<std::string, Value>> entries;
+        size_t next = 0;
+        bool exhausted = false;
+    };
+    std::vector<Source> sources(num_stripes);
+    // reads the stripe's next entries after `from`
+    auto refill = [&](size_t i, const std::string& from) {
+        Source& source = sources[i];
+        source.entries.clear();
+        source.next = 0;
+        std::shared_lock<std::shared_mutex> lock(stripes[i].mutex);
+        source.exhausted = (stripes[i].*table).VisibleAfter(from, at, REFILL, &source.entries);
+    };
+
+    // min-heap of stripes by their next key
+    auto later = [&sources](size_t a, size_t b) {
+        return sources[a].entries[sources[a].next].first > sources[b].entries[sources[b].next].first;
+    };
+    std::vector<size_t> heap;
+    for (size_t i = 0; i < num_stripes; i++) {
+        refill(i, after);
+        if (!sources[i].entries.empty()) {
+            heap.push_back(i);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    std::vector<std::pair<std::string, Value>> page;
+    size_t bytes = 0;
+    while (!heap.empty() && bytes < max_bytes) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        size_t i = heap.back();
+        Source& source = sources[i];
+        page.push_back(std::move(source.entries[source.next++]));
+        bytes += entrySize(page.back());
+        if (source.next == source.entries.size()) {
+            if (source.exhausted) {
+                heap.pop_back();
+                continue;
+            }
+            refill(i, page.back().first);
+            if (source.entries.empty()) {
+                heap.pop_back();
+                continue;
+            }
+        }
+        std::push_heap(heap.begin(), heap.end(), later);
+    }
+    return page;
+}
+
+}  // namespace
+
+std::vector<std::string> KvStore::View::UserKeysIf(const std::function<bool(const std::string&)>& pred) const {
+    std::vector<std::string> keys;
+    forEachAt(store->user_stripes.get(), store->num_stripes, &UserStripe::users, version,
+              [&](const std::string& key, const std::string&) {
+                  if (pred(key)) {
+                      keys.push_back(key);
+                  }
+              });
+    return keys;
+}
+
+std::vector<std::string> KvStore::View::PostKeysIf(const std::function<bool(const std::string&)>& pred) const {
+    std::vector<std::string> keys;
+    forEachAt(store->post_stripes.get(), store->num_stripes, &PostStripe::posts, version,
+              [&](const std::string& key, const post_t&) {
+                  if (pred(key)) {
+                      keys.push_back(key);
+                  }
+              });
+    return keys;
+}
+
+void KvStore::View::ForEachUser(const std::function<void(const std::string&, const std::string&)>& fn) const {
+    forEachAt(store->user_stripes.get(), store->num_stripes, &UserStripe::users, version, fn);
+}
+
+void KvStore::View::ForEachPost(const std::function<void(const std::string&, const post_t&)>& fn) const {
+    forEachAt(store->post_stripes.get(), store->num_stripes, &PostStripe::posts, version, fn);
+}
+
+std::vector<std::pair<std::string, std::string>> KvStore::View::UsersAfter(const std::string& after,
+                                                                           size_t max_bytes) const {
+    return pageAfter(store->user_stripes.get(), store->num_stripes, &UserStripe::users, version, after,
+                     max_bytes);
+}
+
+std::vector<std::pair<std::string, post_t>> KvStore::View::PostsAfter(const std::string& after,
+                                                                      size_t max_bytes) const {
+    return pageAfter(store->post_stripes.get(), store->num_stripes, &PostStripe::posts, version, after,
+                     max_bytes);
+}
+
+void KvStore::Load(const Snapshot& snapshot) {
+    // The snapshot is sorted, so each stripe receives its keys in order too:
+    // inserting at the end of its map is a constant time append.
+    snapshot.ForEachUser([this](std::string_view key, std::string_view name) {
+        std::string user_key(key);
+        UserStripe& stripe = userStripe(user_key);
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        stripe.users.Append(std::move(user_key), std::string(name), clock);
+    });
+    snapshot.ForEachPost([this](std::string_view key, std::string_view user, std::string_view content) {
+        std::string post_key(key);
+        post_t post{std::string(user), std::string(content)};
+        PostStripe& stripe = postStripe(post_key);
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        UserStripe& user_stripe = userStripe(post.user_id);
+        {
+            std::unique_lock<std::shared_mutex> user_lock(user_stripe.mutex);
+            user_stripe.user_posts.Add(post.user_id, post_key);
+        }
+        stripe.posts.Append(std::move(post_key), std::move(post), clock);
+    });
+}
+
+size_t KvStore::NumUsers() const {
+    size_t total = 0;
+    for (size_t i = 0; i < num_stripes; i++) {
+        std::shared_lock<std::shared_mutex> lock(user_stripes[i].mutex);
+        total += user_stripes[i].users.Size();
+    }
+    return total;
+}
+
+size_t KvStore::NumPosts() const {
+    size_t total = 0;
+    for (size_t i = 0; i < num_stripes; i++) {
+        std::shared_lock<std::shared_mutex> lock(post_stripes[i].mutex);
+        total += post_stripes[i].posts.Size();
+    }
+    return total;
+}
+
+size_t KvStore::NumOldVersions() const {
+    size_t total = 0;
+    for (size_t i = 0; i < num_stripes; i++) {
+        {
+            std::shared_lock<std::shared_mutex> lock(user_stripes[i].mutex);
+            total += user_stripes[i].users.OldVersions();
+        }
+        std::shared_lock<std::shared_mutex> lock(post_stripes[i].mutex);
+        total += post_stripes[i].posts.OldVersions();
+    }
+    return total;
+}
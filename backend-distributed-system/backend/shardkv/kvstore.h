@@ -0,0 +1,172 @@
+#ifndef SHARDING_KVSTORE_H
+#define SHARDING_KVSTORE_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../common/common.h"
+#include "user_post_index.h"
+#include "versioned_table.h"
+#include "wal.h"
+
+class ReplicationLog;
+class Snapshot;
+
+// Storage engine behind ShardkvServer. It is called concurrently from the gRPC
+// handler threads and from the shardmaster query thread, so the users and the
+// posts tables are split into lock-striped buckets: operations on keys that
+// hash to different stripes never wait on each other, and reads of the same
+// stripe share its lock.
+//
+// Users and posts live in separate stripe arrays. A post write locks its post
+// stripe and then the stripe of the user it belongs to (for the timeline
+// index); nothing ever locks a user stripe before a post stripe, so the two
+// cannot deadlock.
+//
+// With a WriteAheadLog attached, every change is appended to the log while the
+// stripe lock that orders it is held, so the log has the changes of a key in
+// the order they were applied. The wait for the disk happens after the locks
+// are released. Changes are numbered for the backup (ReplicationLog) the same
+// way.
+//
+// Long scans (a Dump, the key scans of a migration, a snapshot) read a View
+// from Freeze(): a point-in-time copy of the store that costs nothing up
+// front. Writers keep going at full speed, and the values they replace are
+// kept aside only while an open view can still see them.
+class KvStore {
+public:
+    class View;
+
+    explicit KvStore(size_t num_stripes = DEFAULT_STRIPES);
+
+    // Writes are durable when they return if a log is attached, and applied by
+    // the backup if one follows the replication log, unless sync is false:
+    // then they are only in the log's buffer and on their way to the backup
+    // until the next Sync().
+
+    // user_<id> -> name
+    void PutUser(const std::string& key, const std::string& value, bool sync = true);
+    bool GetUser(const std::string& key, std::string* value) const;
+    bool DeleteUser(const std::string& key, bool sync = true);
+
+    // post_<id> -> {author, content}
+    void PutPost(const std::string& key, const post_t& post, bool sync = true);
+    bool GetPost(const std::string& key, post_t* post) const;
+    bool DeletePost(const std::string& key, bool sync = true);
+
+    // logs every change from now on to log, which must outlive the store
+    void SetLog(WriteAheadLog* log);
+    // numbers every change from now on for the backup, see ReplicationLog.
+    // replication must outlive the store.
+    void SetReplication(ReplicationLog* replication);
+    // waits until all the changes made so far are durable and replicated
+    void Sync();
+    // redoes a logged or replicated change
+    void Apply(const WalRecord& record, bool sync = true);
+
+    // timeline of a user ("post_1,post_2,"), see UserPostIndex::Posts
+    std::string UserPosts(const std::string& user) const;
+
+    // all user keys, sorted
+    std::vector<std::string> UserKeys() const;
+
+    // the store as it is now, until the view is released. Writers are held
+    // only while the clock is bumped, not for the scans of the view.
+    std::shared_ptr<const View> Freeze() const;
+
+    // bulk-loads a snapshot into the store, for a restart before the log is
+    // replayed over it
+    void Load(const Snapshot& snapshot);
+
+    size_t NumUsers() const;
+    size_t NumPosts() const;
+    // overwritten or deleted values kept for the open views
+    size_t NumOldVersions() const;
+
+    static constexpr size_t DEFAULT_STRIPES = 64;
+
+private:
+    // padded to a cache line so neighbouring stripe locks don't false-share
+    struct alignas(64) UserStripe {
+        mutable std::shared_mutex mutex;
+        VersionedTable<std::string> users;
+        // user key -> post keys, for the users hashing to this stripe. Not
+        // versioned, views don't read it.
+        UserPostIndex user_posts;
+    };
+    struct alignas(64) PostStripe {
+        mutable std::shared_mutex mutex;
+        VersionedTable<post_t> posts;
+    };
+
+    UserStripe& userStripe(const std::string& key) const;
+    PostStripe& postStripe(const std::string& key) const;
+
+    // where a change went: its seq in the log and in the replication log, 0
+    // for those that are not attached
+    struct Logged {
+        uint64_t log_seq;
+        uint64_t replication_seq;
+    };
+    // appends the change to the log and the replication log. Call with the
+    // stripe lock held.
+    Logged logChange(const WalRecord& record);
+    void waitDurable(const Logged& logged, bool sync);
+
+    // closes the view at version, dropping the old values nobody needs now
+    void release(uint64_t version) const;
+
+    size_t num_stripes;
+    std::unique_ptr<UserStripe[]> user_stripes;
+    std::unique_ptr<PostStripe[]> post_stripes;
+    WriteAheadLog* log = nullptr;
+    ReplicationLog* replication = nullptr;
+
+    // Writes are stamped with clock, read under their stripe lock. Freeze
+    // bumps it with every stripe locked, so a view at version V sees exactly
+    // the writes stamped V or earlier.
+    mutable uint64_t clock = 1;
+    // guards open_views, and orders Freeze against release
+    mutable std::mutex views_mutex;
+    mutable std::multiset<uint64_t> open_views;
+    // the latest open view, 0 if there is none: writers keep what they replace
+    // if it was written at or before this version
+    mutable std::atomic<uint64_t> newest_view{0};
+};
+
+// A point-in-time view of a KvStore, from KvStore::Freeze. It must not
+// outlive the store. Reading it only takes each stripe's read lock for a few
+// entries at a time, and it can be read from several threads.
+class KvStore::View {
+public:
+    ~View();
+
+    // keys of the users/posts for which pred returns true
+    std::vector<std::string> UserKeysIf(const std::function<bool(const std::string&)>& pred) const;
+    std::vector<std::string> PostKeysIf(const std::function<bool(const std::string&)>& pred) const;
+
+    // every user / post, in no particular order. fn runs without any lock held.
+    void ForEachUser(const std::function<void(const std::string&, const std::string&)>& fn) const;
+    void ForEachPost(const std::function<void(const std::string&, const post_t&)>& fn) const;
+
+    // the users / posts with keys after `after`, in key order, up to about
+    // max_bytes of keys and values (at least one if there is any)
+    std::vector<std::pair<std::string, std::string>> UsersAfter(const std::string& after, size_t max_bytes) const;
+    std::vector<std::pair<std::string, post_t>> PostsAfter(const std::string& after, size_t max_bytes) const;
+
+private:
+    friend class KvStore;
+    View(const KvStore* store, uint64_t version);
+
+    const KvStore* store;
+    uint64_t version;
+};
+
+#endif  // SHARDING_KVSTORE_H
@@ -3,11 +3,12 @@
 #include <cstdio>
 
 #include "shardkv.h"
+#include "../common/log.h"
 
 int main(int argc, char** argv) {
-  if (argc != 4) {
+  if (argc != 4 && argc != 5) {
     fprintf(stderr, "usage: ./shardkv <PORT> <SHARD MANAGER HOSTNAME> " \
-                    "<SHARD MANAGER PORT>\n");
+                    "<SHARD MANAGER PORT> [WRITE-AHEAD LOG PATH]\n");
     return 1;
   }
   // get our hostname so we can construct address for shardkv. we need this
@@ -20,14 +21,21 @@ int main(int argc, char** argv) {
   std::string port(argv[1]);
   std::string addr = hostname + ":" + port;
 
-  fprintf(stdout, "Listening on: %s\n", addr.c_str());
+  LOG_INFO << "Listening on: " << addr;
   std::string shardmaster_addr =
       std::string(argv[2]) + ":" + std::string(argv[3]);
-  fprintf(stdout, "Shardmanager on: %s\n", shardmaster_addr.c_str());
+  LOG_INFO << "Shardmanager on: " << shardmaster_addr;
+
+  // with a log, the last snapshot and the log written since are loaded before
+  // we start serving, and every write is in the log before it is acknowledged
+  std::string wal_path = argc == 5 ? std::string(argv[4]) : "";
+  if (!wal_path.empty()) {
+    LOG_INFO << "Write-ahead log: " << wal_path;
+  }
 
   ::grpc::ServerBuilder builder;
   builder.AddListeningPort(addr, ::grpc::InsecureServerCredentials());
-  ShardkvServer shardkv(addr, shardmaster_addr);
+  ShardkvServer shardkv(addr, shardmaster_addr, wal_path);
   builder.RegisterService(&shardkv);
   std::unique_ptr<::grpc::Server> server = builder.BuildAndStart();
 
@@ -0,0 +1,135 @@
+#include "replication_log.h"
+
+#include <algorithm>
+#include <chrono>
+
+// how many changes are sent ahead of the follower's acks
+constexpr uint64_t REPLICATION_WINDOW = 4096;
+// how long a write waits for the follower to ack it before it is dropped
+constexpr std::chrono::milliseconds REPLICATION_ACK_TIMEOUT(1000);
+// most changes kept for a follower that is behind; past that it has to copy
+// the store again
+constexpr size_t REPLICATION_MAX_KEPT = 1 << 18;
+// how long Next waits for changes, so that its caller can check on its stream
+constexpr std::chrono::milliseconds NEXT_WAIT(100);
+
+uint64_t ReplicationLog::Append(const WalRecord& record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t seq = ++last_seq;
+    if (follower == 0 && !holding) {
+        return seq;
+    }
+    pending.emplace_back(seq, record);
+    if (pending.size() > REPLICATION_MAX_KEPT) {
+        pending.pop_front();
+        uint64_t oldest = pending.front().first;
+        if (holding && hold_after + 1 < oldest) {
+            holding = false;
+        }
+        if (follower != 0 && acked + 1 < oldest) {
+            detach();
+        }
+    }
+    changed.notify_all();
+    return seq;
+}
+
+uint64_t ReplicationLog::LastSeq() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return last_seq;
+}
+
+bool ReplicationLog::WaitAcked(uint64_t seq) {
+    std::unique_lock<std::mutex> lock(mutex);
+    uint64_t waiting_for = follower;
+    auto deadline = std::chrono::steady_clock::now() + REPLICATION_ACK_TIMEOUT;
+    while (waiting_for != 0 && follower == waiting_for && acked < seq) {
+        if (acked_cv.wait_until(lock, deadline) == std::cv_status::timeout && follower == waiting_for &&
+            acked < seq) {
+            detach();
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t ReplicationLog::Hold() {
+    std::lock_guard<std::mutex> lock(mutex);
+    hold_after = holding ? std::min(hold_after, last_seq) : last_seq;
+    holding = true;
+    return last_seq;
+}
+
+uint64_t ReplicationLog::Attach(uint64_t after) {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t oldest = pending.empty() ? last_seq + 1 : pending.front().first;
+    if (after > last_seq || after + 1 < oldest) {
+        return 0;
+    }
+    follower = next_follower++;
+    acked = after;
+    holding = false;
+    trim();
+    changed.notify_all();
+    acked_cv.notify_all();
+    return follower;
+}
+
+bool ReplicationLog::Next(uint64_t follower, uint64_t after, size_t max,
+                          std::vector<std::pair<uint64_t, WalRecord>>* out) {
+    out->clear();
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [&]() { return last_seq > after && after - acked < REPLICATION_WINDOW; };
+    changed.wait_for(lock, NEXT_WAIT, [&]() { return this->follower != follower || ready(); });
+    if (this->follower != follower) {
+        return false;
+    }
+    if (!ready()) {
+        return true;
+    }
+    // everything after acked is pending, and after >= acked
+    auto it = pending.begin() + (after + 1 - pending.front().first);
+    for (; it != pending.end() && out->size() < max; ++it) {
+        out->push_back(*it);
+    }
+    return true;
+}
+
+void ReplicationLog::Ack(uint64_t follower, uint64_t seq) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (this->follower != follower || seq <= acked) {
+        return;
+    }
+    acked = seq;
+    trim();
+    acked_cv.notify_all();
+    // the window moved
+    changed.notify_all();
+}
+
+void ReplicationLog::Detach(uint64_t follower) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (this->follower == follower) {
+        detach();
+    }
+}
+
+void ReplicationLog::detach() {
+    follower = 0;
+    trim();
+    changed.notify_all();
+    acked_cv.notify_all();
+}
+
+void ReplicationLog::trim() {
+    uint64_t keep_after = last_seq;
+    if (follower != 0) {
+        keep_after = std::min(keep_after, acked);
+    }
+    if (holding) {
+        keep_after = std::min(keep_after, hold_after);
+    }
+    while (!pending.empty() && pending.front().first <= keep_after) {
+        pending.pop_front();
+    }
+}
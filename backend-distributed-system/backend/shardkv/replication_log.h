@@ -0,0 +1,73 @@
+#ifndef SHARDING_REPLICATION_LOG_H
+#define SHARDING_REPLICATION_LOG_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "wal.h"
+
+// Primary side of the replication to the backup (see ShardkvServer::Replicate).
+//
+// KvStore numbers every change here while it holds the stripe lock that orders
+// it, so seq order is the order the changes were applied in. One follower, the
+// backup, reads them in order over a single stream: changes are sent in
+// batches as they come, up to REPLICATION_WINDOW ahead of its acks, and the
+// acks are cumulative ("everything up to seq is applied"). A writer waits in
+// WaitAcked for the ack covering its own change, so concurrent writers share
+// the round trips to the backup instead of queueing behind each other.
+//
+// Changes are kept only while somebody may still send them: until the
+// follower acks them, or from a Hold (a Dump in progress) until a follower
+// attaches.
+class ReplicationLog {
+public:
+    // numbers a change and queues it for the follower
+    uint64_t Append(const WalRecord& record);
+    uint64_t LastSeq() const;
+
+    // waits until the follower has applied change seq. true right away if no
+    // follower is attached; false if it did not ack in time, and it is dropped
+    // then.
+    bool WaitAcked(uint64_t seq);
+
+    // keeps the changes after the seq returned until a follower attaches, for
+    // a backup copying a view of the store frozen right after the call
+    uint64_t Hold();
+
+    // makes the follower start after change `after`, replacing any other one.
+    // Returns its id, or 0 if changes after `after` are not kept anymore.
+    uint64_t Attach(uint64_t after);
+    // waits a little for changes after `after` that fit in the window and
+    // copies up to max of them into out (none if the wait ran out). false once
+    // the follower is detached.
+    bool Next(uint64_t follower, uint64_t after, size_t max, std::vector<std::pair<uint64_t, WalRecord>>* out);
+    // the follower has applied everything up to seq
+    void Ack(uint64_t follower, uint64_t seq);
+    void Detach(uint64_t follower);
+
+private:
+    // drops the changes nobody can ask for anymore. Call with mutex held.
+    void trim();
+    void detach();
+
+    mutable std::mutex mutex;
+    // signalled when a change is appended, acked, or the follower changes
+    std::condition_variable changed;
+    // signalled when an ack comes in or the follower changes
+    std::condition_variable acked_cv;
+    uint64_t last_seq = 0;
+    // changes after min(acked, hold_after), oldest first
+    std::deque<std::pair<uint64_t, WalRecord>> pending;
+    bool holding = false;
+    uint64_t hold_after = 0;
+    // id of the attached follower, 0 if none, and the last change it acked
+    uint64_t follower = 0;
+    uint64_t next_follower = 1;
+    uint64_t acked = 0;
+};
+
+#endif  // SHARDING_REPLICATION_LOG_H
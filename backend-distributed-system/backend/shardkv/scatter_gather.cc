@@ -0,0 +1,40 @@
+#include "scatter_gather.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+std::vector<GatherResult> ScatterGet(ChannelPool& channels,
+                                     const std::vector<std::string>& addresses,
+                                     const GetRequest& request,
+                                     std::chrono::milliseconds timeout) {
+    std::vector<GatherResult> results(addresses.size());
+    std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+    std::vector<std::unique_ptr<Shardkv::Stub>> stubs;
+
+    // counts the calls still running, the last one to finish wakes us up
+    std::mutex mutex;
+    std::condition_variable all_done;
+    size_t pending = addresses.size();
+
+    auto deadline = std::chrono::system_clock::now() + timeout;
+    for (size_t i = 0; i < addresses.size(); i++) {
+        results[i].address = addresses[i];
+        contexts.push_back(std::make_unique<grpc::ClientContext>());
+        contexts[i]->set_deadline(deadline);
+        stubs.push_back(Shardkv::NewStub(channels.Get(addresses[i])));
+        stubs[i]->async()->Get(contexts[i].get(), &request, &results[i].response,
+                               [&, i](grpc::Status status) {
+                                   std::lock_guard<std::mutex> lock(mutex);
+                                   results[i].status = std::move(status);
+                                   if (--pending == 0) {
+                                       all_done.notify_one();
+                                   }
+                               });
+    }
+
+    // every call completes, if only with DEADLINE_EXCEEDED
+    std::unique_lock<std::mutex> lock(mutex);
+    all_done.wait(lock, [&]() { return pending == 0; });
+    return results;
+}
@@ -0,0 +1,28 @@
+#ifndef SHARDING_SCATTER_GATHER_H
+#define SHARDING_SCATTER_GATHER_H
+
+#include <grpcpp/grpcpp.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../common/channel_pool.h"
+#include "../build/shardkv.grpc.pb.h"
+
+// the answer of one server to a scattered Get
+struct GatherResult {
+    std::string address;
+    grpc::Status status;
+    GetResponse response;
+};
+
+// Sends request to every address at once and waits for all the answers, so
+// the whole thing takes as long as the slowest server rather than the sum of
+// them. Each call gets timeout; a server that fails or is too slow only loses
+// its own part, check status on every result.
+std::vector<GatherResult> ScatterGet(ChannelPool& channels,
+                                     const std::vector<std::string>& addresses,
+                                     const GetRequest& request,
+                                     std::chrono::milliseconds timeout);
+
+#endif  // SHARDING_SCATTER_GATHER_H
@@ -0,0 +1,49 @@
+#include "shard_ownership.h"
+
+#include <algorithm>
+
+OwnershipSnapshot::OwnershipSnapshot(uint64_t version, std::vector<shard_t> shards,
+                                     std::unordered_map<std::string, std::vector<shard_t>> other_managers)
+    : version(version), shards(std::move(shards)), other_managers(std::move(other_managers)) {
+    sortAscendingInterval(this->shards);
+    for (const auto& entry : this->other_managers) {
+        for (const shard_t& s : entry.second) {
+            other_shards.emplace_back(s, entry.first);
+        }
+    }
+    std::sort(other_shards.begin(), other_shards.end(),
+              [](const std::pair<shard_t, std::string>& a, const std::pair<shard_t, std::string>& b) {
+                  return a.first.lower < b.first.lower;
+              });
+}
+
+bool OwnershipSnapshot::Owns(unsigned int key) const {
+    // first shard starting after key; the candidate is the one before it
+    auto it = std::upper_bound(shards.begin(), shards.end(), key,
+                               [](unsigned int k, const shard_t& s) { return k < s.lower; });
+    if (it == shards.begin()) {
+        return false;
+    }
+    --it;
+    return key <= it->upper;
+}
+
+std::string OwnershipSnapshot::OwnerOf(unsigned int key) const {
+    auto it = std::upper_bound(other_shards.begin(), other_shards.end(), key,
+                               [](unsigned int k, const std::pair<shard_t, std::string>& s) {
+                                   return k < s.first.lower;
+                               });
+    if (it == other_shards.begin()) {
+        return "";
+    }
+    --it;
+    return key <= it->first.upper ? it->second : "";
+}
+
+unsigned int keyID(const std::string& key) {
+    std::string key_str = key.substr(5);
+    if (key.find("posts") != std::string::npos) {
+        key_str = key_str.substr(0, key_str.length()-6);
+    }
+    return stoul(key_str);
+}
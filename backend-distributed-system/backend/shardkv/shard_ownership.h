@@ -0,0 +1,46 @@
+#ifndef SHARDING_SHARD_OWNERSHIP_H
+#define SHARDING_SHARD_OWNERSHIP_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/common.h"
+
+// Immutable view of one shardmaster configuration, as seen by a shardkv: the
+// shards its own shardmanager is responsible for, and those of every other
+// shardmanager. A new snapshot is built for every configuration and published
+// through an RcuPtr, so request handlers never lock to check ownership.
+class OwnershipSnapshot {
+public:
+    OwnershipSnapshot(uint64_t version, std::vector<shard_t> shards,
+                      std::unordered_map<std::string, std::vector<shard_t>> other_managers);
+
+    // true if key falls in one of our shards. O(log shards).
+    bool Owns(unsigned int key) const;
+    // address of the other shardmanager serving key, empty if none does.
+    // O(log shards).
+    std::string OwnerOf(unsigned int key) const;
+
+    uint64_t Version() const { return version; }
+    // our shards, sorted by lower bound
+    const std::vector<shard_t>& Shards() const { return shards; }
+    const std::unordered_map<std::string, std::vector<shard_t>>& OtherManagers() const {
+        return other_managers;
+    }
+
+private:
+    uint64_t version;
+    std::vector<shard_t> shards;
+    std::unordered_map<std::string, std::vector<shard_t>> other_managers;
+    // every shard of other_managers with its manager, sorted by lower bound
+    std::vector<std::pair<shard_t, std::string>> other_shards;
+};
+
+// the numeric id a shardkv key is routed by: user_<id>, user_<id>_posts and
+// post_<id> all map to <id>
+unsigned int keyID(const std::string& key);
+
+#endif  // SHARDING_SHARD_OWNERSHIP_H
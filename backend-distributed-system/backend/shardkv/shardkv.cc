@@ -1,34 +1,42 @@
 #include <grpcpp/grpcpp.h>
 #include "shardkv.h"
 #include "../build/shardkv.grpc.pb.h"
+#include "../common/log.h"
 #include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
 using grpc::Channel;
 using grpc::Status;
 using grpc::ClientContext;
 
+// how keys are shipped by MigrateKeys: batch size, batches in flight, and how
+// long a whole migration to one server may take
+constexpr size_t MIGRATE_BATCH_BYTES = 1 << 20;
+constexpr size_t MIGRATE_WINDOW = 8;
+constexpr std::chrono::seconds MIGRATE_TIMEOUT(60);
+constexpr int MIGRATE_RETRIES = 5;
+// how long a timeline read waits for the other servers' part of it. Generous
+// because it also covers the other manager's own hop to its shardkv.
+constexpr std::chrono::milliseconds FANOUT_TIMEOUT(5000);
+// size of the chunks Dump sends unless asked for less, and the most it sends
+// at once whatever is asked
+constexpr size_t DUMP_CHUNK_BYTES = 1 << 20;
+constexpr size_t DUMP_MAX_CHUNK_BYTES = 2 << 20;
+constexpr int DUMP_RETRIES = 5;
+// most changes in a Replicate batch
+constexpr size_t REPLICATE_BATCH = 256;
+
 enum class RequestType {
     ALL_USERS,
     POST,
     USER,
     OTHER
 };
-mutex mutex_shards_assigned;
-
 
-bool keyassignstatus(string key,vector<shard_t>& shards_assigned){
-    string key_str = key.substr(5);
-    if (key.find("posts") != std::string::npos) {
-        key_str = key_str.substr(0, key_str.length()-6);
-    }
-    unsigned int key_int = stoul(key_str);
-    mutex_shards_assigned.lock();
-    for(shard s: shards_assigned){ if(s.lower <= key_int && s.upper >= key_int){
-            mutex_shards_assigned.unlock();
-            return true;
-        }
-    }
-    mutex_shards_assigned.unlock();
-    return false;
+bool ShardkvServer::keyassignstatus(const string& key) const {
+    return ownership.Read()->Owns(keyID(key));
 }
 
 
@@ -60,6 +68,7 @@ RequestType GetRequestType(const std::string& key) {
 ::grpc::Status ShardkvServer::Get(::grpc::ServerContext* context,
                                   const ::GetRequest* request,
                                   ::GetResponse* response) {
+    RpcTimer timer(stats, STATS_GET);
     string key = request->key();
     bool NO_REQ = false;
     if (key.find("_no_req") != std::string::npos) {
@@ -67,93 +76,92 @@ RequestType GetRequestType(const std::string& key) {
         NO_REQ = true;
     }
 
-    cout << "in shardkv, get, key: " << request->key() << endl;
+    LOG_DEBUG << "in shardkv, get, key: " << request->key();
     bool is_all_users = key.compare("all_users") == 0;
-    if(!NO_REQ && (!is_all_users && !::keyassignstatus(key, shards_assigned))) {
-        cerr << "shrdkv not responsible of this key" << endl;
-        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "key is not assigned to this shardkv");
+    if(!NO_REQ && (!is_all_users && !keyassignstatus(key))) {
+        LOG_DEBUG << "shrdkv not responsible of this key";
+        return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "key is not assigned to this shardkv"));
+    }
+    // the fan-out of a user's posts is not a request for this shard
+    if (!NO_REQ && !is_all_users) {
+        stats.CountKey(keyID(key));
     }
 
     try {
         switch (GetRequestType(key)) {
             case RequestType::ALL_USERS: {
                 // List all users
-                cout << "listing all users" << endl;
+                LOG_DEBUG << "listing all users";
                 string res = "";
-                for (const auto& it : users) {
-                    res += it.first + ",";
+                for (const string& user_key : store.UserKeys()) {
+                    res += user_key + ",";
                 }
                 response->set_data(res);
-                return ::grpc::Status(::grpc::Status::OK);
+                return timer.Done(::grpc::Status(::grpc::Status::OK));
             }
             case RequestType::POST: {
                 // Get a post
-                if (posts.count(key) == 0) {
-                    return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "post does not exist");
+                post_t post;
+                if (!store.GetPost(key, &post)) {
+                    return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "post does not exist"));
                 }
-                response->set_data(posts[key].content);
-                return ::grpc::Status(::grpc::Status::OK);
+                response->set_data(post.content);
+                return timer.Done(::grpc::Status(::grpc::Status::OK));
             }
             case RequestType::USER: {
                 // Get user posts
                 string user_key = key.substr(0, key.size()-6);
-                string res = "";
-                for (const auto& it : posts) {
-                    if (it.second.user_id == user_key) {
-                        res += it.first + ",";
-                    }
-                }
+                string res = store.UserPosts(user_key);
 
                 if (!NO_REQ) {
-                    for (const auto& entry : other_managers_shard) {
-                        const std::string& serv_name = entry.first;
-
-                        cout << "asking to other managers" << endl;
-                        ClientContext cc;
-                        GetRequest req;
-                        std::string new_key = key + "_no_req";
-                        req.set_key(new_key);
-                        GetResponse get_resp;
-
-                        auto channel = grpc::CreateChannel(serv_name, grpc::InsecureChannelCredentials());
-                        auto kvStub = Shardkv::NewStub(channel);
-                        auto status = kvStub->Get(&cc, req, &get_resp);
-
-                        if (status.ok()) {
-                            cout << serv_name << " answered with " << get_resp.data() << endl;
-                            res += get_resp.data();
+                    // the user's posts can live on any server, ask all of them
+                    // at once
+                    std::vector<std::string> managers;
+                    {
+                        auto config = ownership.Read();
+                        for (const auto& entry : config->OtherManagers()) {
+                            managers.push_back(entry.first);
+                        }
+                    }
+                    GetRequest req;
+                    req.set_key(key + "_no_req");
+                    for (const GatherResult& result : ScatterGet(channels, managers, req, FANOUT_TIMEOUT)) {
+                        if (result.status.ok()) {
+                            LOG_DEBUG << result.address << " answered with " << result.response.data();
+                            res += result.response.data();
                         } else {
-                            cout << serv_name << " DID NOT ANSWER " << status.error_message() << endl;
+                            LOG_WARNING << result.address << " DID NOT ANSWER " << result.status.error_message();
                         }
                     }
                 }
 
                 if (res.empty()) {
-                    return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "user does not have posts");
+                    return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "user does not have posts"));
                 } else {
                     response->set_data(res);
-                    return ::grpc::Status(::grpc::Status::OK);
+                    return timer.Done(::grpc::Status(::grpc::Status::OK));
                 }
             }
             case RequestType::OTHER: {
                 // Get user
-                if (users.count(key) == 0) {
-                    return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "user does not exist");
+                string name;
+                if (!store.GetUser(key, &name)) {
+                    return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "user does not exist"));
                 } else {
-                    response->set_data(users[key]);
-                    return ::grpc::Status(::grpc::Status::OK);
+                    response->set_data(name);
+                    return timer.Done(::grpc::Status(::grpc::Status::OK));
                 }
             }
             default: {
-                return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "invalid request type");
+                return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "invalid request type"));
             }
         }
     } catch (const std::exception& e) {
         response->set_data(e.what());
-        return ::grpc::Status(::grpc::Status::OK);
+        return timer.Done(::grpc::Status(::grpc::Status::OK));
     }
 
-    return ::grpc::Status(::grpc::Status::OK);
+    return timer.Done(::grpc::Status(::grpc::Status::OK));
 }
 
     
@@ -176,15 +184,17 @@ RequestType GetRequestType(const std::string& key) {
 ::grpc::Status ShardkvServer::Put(::grpc::ServerContext* context,
                                   const ::PutRequest* request,
                                   Empty* response) {
+    RpcTimer timer(stats, STATS_PUT);
     // Log the key, data, and user of the put request
-    cout << "Processing put request in shardkv. Key: " << request->key() << ", Data: " << request->data() << ", User: " << request->user() << endl;
+    LOG_DEBUG << "Processing put request in shardkv. Key: " << request->key() << ", Data: " << request->data() << ", User: " << request->user();
 
     // Extract key from the request
     string key = request->key();
 
     // Check if the key is assigned to this shardkv server
-    if (!::keyassignstatus(key, shards_assigned))
-        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "the key is not assigned to this shardkv");
+    if (!keyassignstatus(key))
+        return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "the key is not assigned to this shardkv"));
+    stats.CountKey(keyID(key));
 
     // Process the put request based on the key type
     if (key.rfind("post", 0) == 0) {
@@ -192,18 +202,12 @@ RequestType GetRequestType(const std::string& key) {
         post_t post = post_t();
         post.content = request->data();
         post.user_id = request->user();
-        posts[key] = post; // Store the post in the posts map
+        store.PutPost(key, post); // Store the post in the posts table
     } else {
-        users[request->key()] = request->data(); 
+        store.PutUser(request->key(), request->data());
     }
-    cout << "Updated users map:" << endl;
-    for_each(users.begin(),
-             users.end(),
-             [](const std::pair<string, string> &p) {
-                 std::cout << "{" << p.first << ": " << p.second << "}\n";
-             });
 
-    return ::grpc::Status(::grpc::Status::OK);
+    return timer.Done(::grpc::Status(::grpc::Status::OK));
 }
 
 /**
@@ -222,8 +226,9 @@ RequestType GetRequestType(const std::string& key) {
 ::grpc::Status ShardkvServer::Append(::grpc::ServerContext* context,
                                      const ::AppendRequest* request,
                                      Empty* response) {
-    cout << "in the shardkv append, key: " << request->key() << ", data: " << request->data() << endl;
-    return ::grpc::Status(::grpc::Status::OK);
+    RpcTimer timer(stats, STATS_APPEND);
+    LOG_DEBUG << "in the shardkv append, key: " << request->key() << ", data: " << request->data();
+    return timer.Done(::grpc::Status(::grpc::Status::OK));
     }
 
 /**
@@ -241,35 +246,41 @@ RequestType GetRequestType(const std::string& key) {
 ::grpc::Status ShardkvServer::Delete(::grpc::ServerContext* context,
                                      const ::DeleteRequest* request,
                                      Empty* response) {
-    cout << "Processing delete request in shardkv. Key: " << request->key() << endl;
+    RpcTimer timer(stats, STATS_DELETE);
+    LOG_DEBUG << "Processing delete request in shardkv. Key: " << request->key();
 
     // Extract key from the request
     string key = request->key();
+    stats.CountKey(keyID(key));
     // Check if the key is for a post or a user, and delete accordingly
     if (key.rfind("post", 0) == 0) {
         // Delete request for a post
-        if (posts.count(key) == 0)
-            return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Post does not exist");
-        posts.erase(key); // Remove the post from the posts map
+        if (!store.DeletePost(key)) // Remove the post from the posts table
+            return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Post does not exist"));
     } else {
-        if (users.count(key) == 0)
-            return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "User does not exist");
-        users.erase(key); // Remove the user from the users map
+        if (!store.DeleteUser(key)) // Remove the user from the users table
+            return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "User does not exist"));
     }
 
-    // Log the updated users map
-    cout << "Updated users map:" << endl;
-    for_each(users.begin(),
-             users.end(),
-             [](const std::pair<string, string> &p) {
-                 std::cout << "{" << p.first << ": " << p.second << "}\n";
-             });
+    return timer.Done(::grpc::Status(::grpc::Status::OK));
+}
 
-    return ::grpc::Status(::grpc::Status::OK);
+/**
+ * Latencies of Get, Put, Append and Delete since we started, and how many of
+ * them went to each of the shards we hold.
+ *
+ * @param context - you can ignore this
+ * @param request - an empty message
+ * @param response the stats
+ * @return ::grpc::Status::OK
+ */
+::grpc::Status ShardkvServer::Stats(::grpc::ServerContext* context, const Empty* request, ::StatsResponse* response) {
+    stats.Fill(response, ownership.Read()->Shards());
+    return ::grpc::Status::OK;
 }
 /**
- * This method is called in a separate thread on periodic intervals (see the
- * constructor in shardkv.h for how this is done). It should query the shardmaster
+ * This method is called by the query thread whenever its Watch stream breaks
+ * (see the constructor in shardkv.h for how this is done). It should query the shardmaster
  * for an updated configuration of how shards are distributed. You should then
  * find this server in that configuration and look at the shards associated with
  * it. These are the shards that the shardmaster deems this server responsible
@@ -293,58 +304,293 @@ void ShardkvServer::QueryShardmaster(Shardmaster::Stub* stub) {
 
     switch (status.error_code()) {
         case grpc::StatusCode::OK: {
-            other_managers_shard.clear();
-            for (const ConfigEntry& config : res.config()) {
-                const std::string& currentServer = config.server();
-
-                if (currentServer != shardmanager_address) {
-                    // Server entry for other managers
-                    std::vector<shard_t> serverShards;
-
-                    for (const Shard& s : config.shards()) {
-                        shard_t new_shard;
-                        new_shard.lower = s.lower();
-                        new_shard.upper = s.upper();
-                        serverShards.push_back(new_shard);
-                    }
+            ApplyConfig(res);
+            break;
+        }
+        default: {
+            logError("Query", status);
+            break;
+        }
+    }
+}
 
-                    other_managers_shard[currentServer] = serverShards;
-                } else {
-                    // Shards assigned to the current manager
-                    mutex_shards_assigned.lock();
-                    shards_assigned.clear();
-
-                    for (const Shard& s : config.shards()) {
-                        shard_t new_shard;
-                        new_shard.lower = s.lower();
-                        new_shard.upper = s.upper();
-                        shards_assigned.push_back(new_shard);
-                    }
+/**
+ * Opens a Watch stream on the shardmaster starting from the config we already
+ * have, and applies every configuration it pushes. Config changes reach us as
+ * soon as the shardmaster makes them, without polling.
+ *
+ * @param stub a grpc stub for the shardmaster, which we use to invoke the Watch
+ * method!
+ */
+void ShardkvServer::WatchShardmaster(Shardmaster::Stub* stub) {
+    ClientContext cc;
+    WatchRequest req;
+    req.set_since_config_num(ownership.Read()->Version());
+    std::unique_ptr<::grpc::ClientReader<QueryResponse>> reader(stub->Watch(&cc, req));
 
-                    mutex_shards_assigned.unlock();
-                }
-            }
+    QueryResponse res;
+    while (reader->Read(&res)) {
+        ApplyConfig(res);
+    }
+    auto status = reader->Finish();
+    if (!status.ok()) {
+        logError("Watch", status);
+    }
+}
 
-            // Transfer keys that are not assigned to this server anymore
-            vector<string> keys_to_remove;
-            for (const auto& entry : users) {
-                const string& key = entry.first;
-                if (!::keyassignstatus(key, shards_assigned)) {
-                    keys_to_remove.push_back(key);
-                }
+void ShardkvServer::ApplyConfig(const QueryResponse& res) {
+    if (res.config_num() == ownership.Read()->Version()) {
+        return;
+    }
+
+    std::vector<shard_t> my_shards;
+    std::unordered_map<std::string, std::vector<shard_t>> other_managers;
+    for (const ConfigEntry& config : res.config()) {
+        const std::string& currentServer = config.server();
+
+        // our manager's entry gives the shards we serve, the others
+        // are where the rest of the key space lives
+        std::vector<shard_t>& serverShards =
+                currentServer == shardmanager_address ? my_shards : other_managers[currentServer];
+        for (const Shard& s : config.shards()) {
+            shard_t new_shard;
+            new_shard.lower = s.lower();
+            new_shard.upper = s.upper();
+            serverShards.push_back(new_shard);
+        }
+    }
+    // request handlers keep using the old snapshot until they finish,
+    // nobody waits for this swap
+    ownership.Publish(std::make_unique<const OwnershipSnapshot>(
+            res.config_num(), std::move(my_shards), std::move(other_managers)));
+
+    // connect to new managers now, not on the first timeline read that needs them
+    auto config = ownership.Read();
+    for (const auto& entry : config->OtherManagers()) {
+        channels.Get(entry.first);
+    }
+
+    // Transfer keys that are not assigned to this server anymore, grouped by
+    // the shardmanager that serves them now
+    auto not_owned = [&config](const string& key) {
+        return !config->Owns(keyID(key));
+    };
+    std::map<std::string, std::vector<std::string>> moving_users;
+    std::map<std::string, std::vector<std::string>> moving_posts;
+    {
+        // scanned from a frozen view, so clients keep writing meanwhile
+        auto view = store.Freeze();
+        for (const string& key : view->UserKeysIf(not_owned)) {
+            moving_users[config->OwnerOf(keyID(key))].push_back(key);
+        }
+        for (const string& key : view->PostKeysIf(not_owned)) {
+            moving_posts[config->OwnerOf(keyID(key))].push_back(key);
+        }
+    }
+
+    // the backup's copies go away with the primary's deletes, once the
+    // primary has handed them over
+    if (!is_primary) {
+        return;
+    }
+
+    // nobody serves these anymore, there is no one to hand them to
+    for (const string& key : moving_users[""]) {
+        store.DeleteUser(key, false);
+        LOG_DEBUG << "Removed key: " << key;
+    }
+    for (const string& key : moving_posts[""]) {
+        store.DeletePost(key, false);
+        LOG_DEBUG << "Removed key: " << key;
+    }
+    store.Sync();
+    moving_users.erase("");
+    moving_posts.erase("");
+
+    std::set<std::string> new_owners;
+    for (const auto& entry : moving_users) {
+        new_owners.insert(entry.first);
+    }
+    for (const auto& entry : moving_posts) {
+        new_owners.insert(entry.first);
+    }
+    for (const std::string& manager : new_owners) {
+        int attempt = 0;
+        while (!MigrateKeys(manager, moving_users[manager], moving_posts[manager])) {
+            if (++attempt == MIGRATE_RETRIES) {
+                // whatever was not acked stays here and is sent again on the
+                // next config change
+                LOG_WARNING << "giving up migrating keys to " << manager << " for now";
+                break;
             }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+}
 
-            for (const string& key : keys_to_remove) {
-                users.erase(key);
-                cout << "Removed key: " << key << endl;
+/**
+ * Hands the given keys over to the shardkv behind manager on a MigrateRange
+ * stream. Keys are sent in batches of about MIGRATE_BATCH_BYTES, with at most
+ * MIGRATE_WINDOW batches waiting for an ack, and a key is only deleted here once
+ * the batch holding it has been acked. Keys that are already gone (moved by an
+ * earlier attempt) are skipped, so a failed migration can simply be retried.
+ *
+ * @param manager the shardmanager now serving the keys
+ * @param users user keys to move
+ * @param posts post keys to move
+ * @return true if every key was moved
+ */
+bool ShardkvServer::MigrateKeys(const std::string& manager,
+                                const std::vector<std::string>& users,
+                                const std::vector<std::string>& posts) {
+    ClientContext cc;
+    cc.set_deadline(std::chrono::system_clock::now() + MIGRATE_TIMEOUT);
+    auto stub = Shardkv::NewStub(channels.Get(manager));
+    auto stream = stub->MigrateRange(&cc);
+
+    // the keys of a batch, deleted once it is acked
+    struct InFlight {
+        uint64_t seq = 0;
+        std::vector<std::string> users;
+        std::vector<std::string> posts;
+    };
+    std::deque<InFlight> in_flight;
+    uint64_t seq = 0;
+    MigrateBatch batch;
+    InFlight pending;
+    size_t batch_bytes = 0;
+
+    auto awaitAck = [&]() {
+        MigrateAck ack;
+        if (!stream->Read(&ack) || ack.seq() != in_flight.front().seq) {
+            return false;
+        }
+        for (const string& key : in_flight.front().users) {
+            store.DeleteUser(key, false);
+        }
+        for (const string& key : in_flight.front().posts) {
+            store.DeletePost(key, false);
+        }
+        // a key we still had after a restart would be sent again, over
+        // whatever the new owner wrote to it since
+        store.Sync();
+        in_flight.pop_front();
+        return true;
+    };
+    auto flush = [&]() {
+        batch.set_seq(++seq);
+        pending.seq = seq;
+        if (!stream->Write(batch)) {
+            return false;
+        }
+        in_flight.push_back(std::move(pending));
+        pending = InFlight();
+        batch.Clear();
+        batch_bytes = 0;
+        while (in_flight.size() >= MIGRATE_WINDOW) {
+            if (!awaitAck()) {
+                return false;
             }
-            break;
         }
-        default: {
-            logError("Query", status);
-            break;
+        return true;
+    };
+
+    bool ok = true;
+    string name;
+    for (size_t i = 0; ok && i < users.size(); i++) {
+        if (!store.GetUser(users[i], &name)) {
+            continue;
         }
+        (*batch.mutable_users())[users[i]] = name;
+        pending.users.push_back(users[i]);
+        batch_bytes += users[i].size() + name.size();
+        if (batch_bytes >= MIGRATE_BATCH_BYTES) {
+            ok = flush();
+        }
+    }
+    post_t post;
+    for (size_t i = 0; ok && i < posts.size(); i++) {
+        if (!store.GetPost(posts[i], &post)) {
+            continue;
+        }
+        MigratePost* entry = batch.add_posts();
+        entry->set_key(posts[i]);
+        entry->set_user(post.user_id);
+        entry->set_content(post.content);
+        pending.posts.push_back(posts[i]);
+        batch_bytes += posts[i].size() + post.user_id.size() + post.content.size();
+        if (batch_bytes >= MIGRATE_BATCH_BYTES) {
+            ok = flush();
+        }
+    }
+    if (ok && (batch.users_size() > 0 || batch.posts_size() > 0)) {
+        ok = flush();
+    }
+    if (ok) {
+        stream->WritesDone();
+        while (ok && !in_flight.empty()) {
+            ok = awaitAck();
+        }
+    }
+    if (!ok) {
+        cc.TryCancel();
+    }
+    auto status = stream->Finish();
+    if (!status.ok()) {
+        logError("MigrateRange", status);
+        return false;
+    }
+    return ok;
+}
+
+/**
+ * Restart path: loads the snapshot next to the log, if there is one, and
+ * replays the log segments written after it. Whatever was acknowledged before
+ * the crash is back in the store when this returns.
+ *
+ * @param wal_path where the log segments live, the snapshot is wal_path.snapshot
+ */
+void ShardkvServer::Recover(const std::string& wal_path) {
+    auto start = std::chrono::steady_clock::now();
+    snapshot_path = wal_path + ".snapshot";
+    uint64_t first_segment = 0;
+    if (std::unique_ptr<Snapshot> snapshot = Snapshot::Open(snapshot_path)) {
+        store.Load(*snapshot);
+        first_segment = snapshot->FirstSegment();
+        LOG_INFO << "Loaded " << snapshot->NumUsers() << " users and " << snapshot->NumPosts() << " posts from "
+                 << snapshot_path;
     }
+    size_t changes = WriteAheadLog::Replay(wal_path, first_segment, [this](const WalRecord& record) {
+        store.Apply(record);
+    });
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LOG_INFO << "Replayed " << changes << " changes from " << wal_path << ", recovered in " << elapsed.count()
+             << " ms";
+
+    wal = std::make_unique<WriteAheadLog>(wal_path);
+    store.SetLog(wal.get());
+}
+
+/**
+ * Called periodically by the snapshot thread (see the constructor in
+ * shardkv.h). The log moves on to a new segment first, so the snapshot holds at
+ * least everything in the older ones, which can then go.
+ */
+void ShardkvServer::TakeSnapshot() {
+    uint64_t seq = wal->LastSeq();
+    if (seq == snapshot_seq) {
+        return;
+    }
+    uint64_t segment = wal->Rotate();
+    try {
+        Snapshot::Write(store, snapshot_path, segment);
+    } catch (const std::exception& e) {
+        // the log still has everything, try again next time
+        LOG_ERROR << "snapshot failed: " << e.what();
+        return;
+    }
+    wal->DropBefore(segment);
+    snapshot_seq = seq;
 }
 
 /**
@@ -363,6 +609,9 @@ void ShardkvServer::QueryShardmaster(Shardmaster::Stub* stub) {
 void ShardkvServer::PingShardmanager(Shardkv::Stub* stub) {
     PingRequest pingReq;
     pingReq.set_server(address);
+    // the backup acks a view once it has copied the primary and follows it,
+    // which lets the shardmanager promote it
+    pingReq.set_viewnumber(synced_view);
 
     PingResponse pingResponse;
     ClientContext cc;
@@ -371,7 +620,31 @@ void ShardkvServer::PingShardmanager(Shardkv::Stub* stub) {
 
     switch (status.error_code()) {
         case grpc::StatusCode::OK: {
+            is_primary = pingResponse.primary() == address;
+            bool is_backup = pingResponse.backup() == address;
             shardmaster_address = pingResponse.shardmaster();
+            if (view.exchange(pingResponse.id()) != pingResponse.id()) {
+                // whatever we followed belongs to the old view
+                std::lock_guard<std::mutex> lock(follow_mutex);
+                if (follow_context) {
+                    follow_context->TryCancel();
+                }
+            }
+            // a new backup copies the primary's store, then keeps up with its
+            // changes. That runs on its own thread, so we keep pinging meanwhile
+            if (is_backup && synced_view != pingResponse.id() && !syncing.exchange(true)) {
+                std::thread sync([this](const std::string primary, uint32_t view) {
+                    uint64_t seq;
+                    if (SyncFromPrimary(primary, &seq)) {
+                        synced_view = view;
+                        FollowPrimary(primary, view, seq);
+                        // copy again if we are still the backup
+                        synced_view = 0;
+                    }
+                    syncing = false;
+                }, pingResponse.primary(), pingResponse.id());
+                sync.detach();
+            }
             break;
         }
         default: {
@@ -387,15 +660,273 @@ void ShardkvServer::PingShardmanager(Shardkv::Stub* stub) {
  * PART 3 ONLY
  *
  * This method is called by a backup server when it joins the system for the firt time or after it crashed and restarted.
- * It allows the server to receive a snapshot of all key-value pairs stored by the primary server.
+ * It streams all key-value pairs stored by the primary server, users then posts, in key order and in chunks of at
+ * most chunk_bytes. Each chunk carries the cursor to resume after it, so a broken stream can be picked up where it
+ * stopped. Chunks are produced one at a time and Write blocks while the stream's flow control window is full, so a
+ * slow backup holds the dump back instead of having it pile up in memory here.
  *
- * @param context - you can ignore this
- * @param request An empty message
- * @param response the whole database
- * @return ::grpc::Status::OK on success, or
- * ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "<your error message
+ * The stream reads a view of the store frozen when it starts (KvStore::Freeze):
+ * writes made while it runs are not in it, and are not held up by it either.
+ * Every chunk carries the last change of the replication stream the view
+ * holds, and the changes after it are kept until the backup asks for them
+ * with Replicate.
+ *
+ * @param context - used to stop when the backup goes away
+ * @param request where to start, and the chunk size
+ * @param writer the chunks out
+ * @return ::grpc::Status::OK once everything was sent, or
+ * ::grpc::Status(::grpc::StatusCode::CANCELLED, "<your error message
  * here>")
  */
-::grpc::Status ShardkvServer::Dump(::grpc::ServerContext* context, const Empty* request, ::DumpResponse* response) {
-    return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Not implemented yet");
+::grpc::Status ShardkvServer::Dump(::grpc::ServerContext* context, const ::DumpRequest* request,
+                                   ::grpc::ServerWriter<::DumpChunk>* writer) {
+    size_t chunk_bytes = request->chunk_bytes() ? request->chunk_bytes() : DUMP_CHUNK_BYTES;
+    chunk_bytes = std::min(chunk_bytes, DUMP_MAX_CHUNK_BYTES);
+    DumpCursor cursor = request->cursor();
+    // taken first: every change up to seq is in the view
+    uint64_t seq = replication.Hold();
+    auto view = store.Freeze();
+    // at least one chunk goes out, even if there is nothing to send, for its seq
+    bool sent = false;
+
+    while (true) {
+        DumpChunk chunk;
+        if (!cursor.users_done()) {
+            auto users = view->UsersAfter(cursor.after(), chunk_bytes);
+            if (users.empty()) {
+                cursor.set_users_done(true);
+                cursor.clear_after();
+                continue;
+            }
+            for (const auto& user : users) {
+                (*chunk.mutable_users())[user.first] = user.second;
+            }
+            cursor.set_after(users.back().first);
+        } else {
+            auto posts = view->PostsAfter(cursor.after(), chunk_bytes);
+            if (posts.empty() && sent) {
+                return ::grpc::Status::OK;
+            }
+            for (const auto& post : posts) {
+                MigratePost* entry = chunk.add_posts();
+                entry->set_key(post.first);
+                entry->set_user(post.second.user_id);
+                entry->set_content(post.second.content);
+            }
+            if (!posts.empty()) {
+                cursor.set_after(posts.back().first);
+            }
+        }
+        *chunk.mutable_cursor() = cursor;
+        chunk.set_seq(seq);
+        if (!writer->Write(chunk)) {
+            return ::grpc::Status(::grpc::StatusCode::CANCELLED, "backup went away");
+        }
+        sent = true;
+    }
+}
+
+/**
+ * Backup side of Dump. Whatever we held before is dropped first, as the
+ * primary's copy replaces it. Chunks are applied as they arrive, so only one
+ * is in memory at a time; if the stream breaks, a new one resumes from the
+ * cursor of the last chunk applied.
+ *
+ * A resumed stream reads a later view of the primary than the chunks before
+ * it, so the copy as a whole is only sure to have the changes up to the
+ * smallest seq of its chunks. Replaying the changes after that one in order
+ * over it fixes up the rest.
+ *
+ * @param primary address of the primary shardkv
+ * @param seq set to the last change the copy is sure to have
+ * @return true once the whole store was copied
+ */
+bool ShardkvServer::SyncFromPrimary(const std::string& primary, uint64_t* seq) {
+    auto everything = [](const string&) { return true; };
+    {
+        auto view = store.Freeze();
+        for (const string& key : view->UserKeysIf(everything)) {
+            store.DeleteUser(key, false);
+        }
+        for (const string& key : view->PostKeysIf(everything)) {
+            store.DeletePost(key, false);
+        }
+    }
+    store.Sync();
+
+    auto stub = Shardkv::NewStub(channels.Get(primary));
+    DumpRequest req;
+    size_t users = 0;
+    size_t posts = 0;
+    *seq = UINT64_MAX;
+    for (int attempt = 0; attempt < DUMP_RETRIES; attempt++) {
+        ClientContext cc;
+        auto reader = stub->Dump(&cc, req);
+        DumpChunk chunk;
+        while (reader->Read(&chunk)) {
+            for (const auto& user : chunk.users()) {
+                store.PutUser(user.first, user.second, false);
+            }
+            for (const MigratePost& post : chunk.posts()) {
+                store.PutPost(post.key(), {post.user(), post.content()}, false);
+            }
+            store.Sync();
+            users += chunk.users_size();
+            posts += chunk.posts_size();
+            *req.mutable_cursor() = chunk.cursor();
+            *seq = std::min(*seq, chunk.seq());
+        }
+        auto status = reader->Finish();
+        if (status.ok()) {
+            LOG_INFO << "Copied " << users << " users and " << posts << " posts from primary " << primary;
+            return true;
+        }
+        logError("Dump", status);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+/**
+ * Receiving end of MigrateKeys: stores every batch of keys handed over by the
+ * previous owner of their shard and acks it. Keys are taken whether or not we
+ * have seen the new configuration yet, as the sender already has.
+ *
+ * @param context - you can ignore this
+ * @param stream the batches in, the acks out
+ * @return ::grpc::Status::OK once the sender is done
+ */
+::grpc::Status ShardkvServer::MigrateRange(::grpc::ServerContext* context,
+                                           ::grpc::ServerReaderWriter<::MigrateAck, ::MigrateBatch>* stream) {
+    MigrateBatch batch;
+    while (stream->Read(&batch)) {
+        for (const auto& user : batch.users()) {
+            store.PutUser(user.first, user.second, false);
+        }
+        for (const MigratePost& post : batch.posts()) {
+            store.PutPost(post.key(), {post.user(), post.content()}, false);
+        }
+        // the sender deletes its copy on the ack, ours must be durable first
+        store.Sync();
+        MigrateAck ack;
+        ack.set_seq(batch.seq());
+        if (!stream->Write(ack)) {
+            return ::grpc::Status(::grpc::StatusCode::CANCELLED, "sender went away");
+        }
+    }
+    return ::grpc::Status::OK;
+}
+
+/**
+ * Sends our changes to the backup, in the order we made them, from the one
+ * after the seq of the backup's first ack. Batches go out as changes come in,
+ * without waiting for the acks of the previous ones (see ReplicationLog for
+ * how far ahead); the acks are read on their own thread and release the
+ * writers waiting for them.
+ *
+ * @param context - used to stop reading acks once we stop sending
+ * @param stream the backup's acks in, our changes out
+ * @return ::grpc::Status::OK once the stream ends, or
+ * ::grpc::Status(::grpc::StatusCode::FAILED_PRECONDITION, "<your error message
+ * here>") if the changes the backup needs are not kept anymore
+ */
+::grpc::Status ShardkvServer::Replicate(::grpc::ServerContext* context,
+                                        ::grpc::ServerReaderWriter<::ReplicateBatch, ::ReplicateAck>* stream) {
+    ReplicateAck start;
+    if (!stream->Read(&start)) {
+        return ::grpc::Status(::grpc::StatusCode::CANCELLED, "backup went away");
+    }
+    uint64_t follower = replication.Attach(start.seq());
+    if (follower == 0) {
+        return ::grpc::Status(::grpc::StatusCode::FAILED_PRECONDITION,
+                              "changes after " + std::to_string(start.seq()) + " are gone, copy the store again");
+    }
+
+    std::thread acks([this, stream, follower]() {
+        ReplicateAck ack;
+        while (stream->Read(&ack)) {
+            replication.Ack(follower, ack.seq());
+        }
+        replication.Detach(follower);
+    });
+
+    uint64_t sent = start.seq();
+    std::vector<std::pair<uint64_t, WalRecord>> changes;
+    while (!context->IsCancelled() && replication.Next(follower, sent, REPLICATE_BATCH, &changes)) {
+        if (changes.empty()) {
+            continue;
+        }
+        ReplicateBatch batch;
+        for (const auto& change : changes) {
+            ReplicatedWrite* write = batch.add_writes();
+            write->set_seq(change.first);
+            write->set_type(static_cast<uint32_t>(change.second.type));
+            write->set_key(change.second.key);
+            write->set_value(change.second.value);
+            write->set_user(change.second.user);
+        }
+        sent = changes.back().first;
+        if (!stream->Write(batch)) {
+            break;
+        }
+    }
+    replication.Detach(follower);
+    // unblocks the acks thread
+    context->TryCancel();
+    acks.join();
+    return ::grpc::Status::OK;
+}
+
+/**
+ * Backup side of Replicate. Each batch is applied in order and acked once it
+ * is (and is in our log, if we keep one). A broken stream is picked up again
+ * from the last change applied, for as long as the view lasts; PingShardmanager
+ * cancels the stream when it changes.
+ *
+ * @param primary address of the primary shardkv
+ * @param view the view in which we are its backup
+ * @param applied the last of the primary's changes we have
+ */
+void ShardkvServer::FollowPrimary(const std::string& primary, uint32_t view, uint64_t applied) {
+    auto stub = Shardkv::NewStub(channels.Get(primary));
+    while (this->view == view) {
+        auto cc = std::make_shared<ClientContext>();
+        {
+            std::lock_guard<std::mutex> lock(follow_mutex);
+            follow_context = cc;
+        }
+        // the view may have changed before the context could be cancelled
+        if (this->view != view) {
+            break;
+        }
+        auto stream = stub->Replicate(cc.get());
+        ReplicateAck ack;
+        ack.set_seq(applied);
+        if (stream->Write(ack)) {
+            ReplicateBatch batch;
+            while (stream->Read(&batch)) {
+                for (const ReplicatedWrite& write : batch.writes()) {
+                    store.Apply({static_cast<WalRecord::Type>(write.type()), write.key(), write.value(), write.user()},
+                                false);
+                    applied = write.seq();
+                }
+                store.Sync();
+                ack.set_seq(applied);
+                if (!stream->Write(ack)) {
+                    break;
+                }
+            }
+        }
+        stream->WritesDone();
+        Status status = stream->Finish();
+        {
+            std::lock_guard<std::mutex> lock(follow_mutex);
+            follow_context.reset();
+        }
+        if (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) {
+            logError("Replicate", status);
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
 }
@@ -2,6 +2,7 @@
 #define SHARDING_SHARDKV_H
 
 #include <grpcpp/grpcpp.h>
+#include <atomic>
 #include <thread>
 #include "../common/common.h"
 #include <unordered_map>
@@ -9,20 +10,53 @@
 #include <iostream>
 #include <fstream>
 
+#include "kvstore.h"
+#include "replication_log.h"
+#include "scatter_gather.h"
+#include "shard_ownership.h"
+#include "snapshot.h"
+#include "../common/channel_pool.h"
+#include "../common/rcu.h"
+#include "../common/rpc_stats.h"
 #include "../build/shardkv.grpc.pb.h"
 #include "../build/shardmaster.grpc.pb.h"
 
+// how often the store is snapshotted when a write-ahead log is used
+constexpr std::chrono::seconds SNAPSHOT_INTERVAL(60);
+
 class ShardkvServer : public Shardkv::Service {
   using Empty = google::protobuf::Empty;
 
  public:
-  explicit ShardkvServer(std::string addr, const std::string& shardmanager_addr)
+  // wal_path: where to log every change, replayed here before serving. No
+  // logging if empty.
+  explicit ShardkvServer(std::string addr, const std::string& shardmanager_addr,
+                         const std::string& wal_path = "")
       : address(std::move(addr)), shardmanager_address(shardmanager_addr) {
+    if (!wal_path.empty()) {
+        Recover(wal_path);
+
+        // This thread replaces the log written since the last snapshot with a
+        // new snapshot, so a restart has little of it to replay
+        std::thread snapshotter(
+                [this]() {
+                    while (true) {
+                        std::this_thread::sleep_for(SNAPSHOT_INTERVAL);
+                        this->TakeSnapshot();
+                    }
+                });
+        // we detach the thread so we don't have to wait for it to terminate later
+        snapshotter.detach();
+    }
+
+    // the backup follows every change made from now on
+    store.SetReplication(&replication);
 
-    // This thread will query the shardmaster every 100 milliseconds for updates
+    // This thread keeps a Watch stream open on the shardmaster, which pushes
+    // every new configuration. If the stream breaks we Query once, so nothing
+    // is missed, and open a new one after 100 milliseconds.
     std::thread query(
             [this]() {
-                // TODO: Assignment 2 Implement the QueryShardmaster(...) function
                 std::chrono::milliseconds timespan(100);
                 while (shardmaster_address.empty()) {
                     std::this_thread::sleep_for(timespan);
@@ -30,6 +64,7 @@ class ShardkvServer : public Shardkv::Service {
                 auto stub = Shardmaster::NewStub(
                         grpc::CreateChannel(shardmaster_address, grpc::InsecureChannelCredentials()));
                 while (true) {
+                    this->WatchShardmaster(stub.get());
                     this->QueryShardmaster(stub.get());
                     std::this_thread::sleep_for(timespan);
                 }
@@ -69,15 +104,47 @@ class ShardkvServer : public Shardkv::Service {
   ::grpc::Status Delete(::grpc::ServerContext* context,
                         const ::DeleteRequest* request,
                         Empty* response) override;
-    ::grpc::Status Dump(::grpc::ServerContext* context,
-                        const ::google::protobuf::Empty* request,
-                        ::DumpResponse* response);
+  ::grpc::Status Dump(::grpc::ServerContext* context, const ::DumpRequest* request,
+                      ::grpc::ServerWriter<::DumpChunk>* writer) override;
+  ::grpc::Status MigrateRange(::grpc::ServerContext* context,
+                              ::grpc::ServerReaderWriter<::MigrateAck, ::MigrateBatch>* stream) override;
+  ::grpc::Status Replicate(::grpc::ServerContext* context,
+                           ::grpc::ServerReaderWriter<::ReplicateBatch, ::ReplicateAck>* stream) override;
+  ::grpc::Status Stats(::grpc::ServerContext* context, const Empty* request,
+                       ::StatsResponse* response) override;
 
   // TODO this will be called in a separate thread, here is where you want to
   // query the shardmaster for configuration updates and respond to changes
   // appropriately (i.e. transferring keys, no longer serving keys, etc.)
   void QueryShardmaster(Shardmaster::Stub* stub);
-  bool keyassignstatus(string key,vector<shard_t>& shards_assigned);
+  // same, but on a Watch stream: applies configurations as the shardmaster
+  // pushes them and only returns once the stream breaks
+  void WatchShardmaster(Shardmaster::Stub* stub);
+  // switches to the given configuration and migrates the keys we lost to
+  // their new owners. Does nothing if we already have that config_num.
+  void ApplyConfig(const QueryResponse& res);
+  // streams keys to the shardkv behind manager with MigrateRange, deleting
+  // them here as they are acked. false if some could not be moved.
+  bool MigrateKeys(const std::string& manager, const std::vector<std::string>& users,
+                   const std::vector<std::string>& posts);
+  // true if the key falls in one of the shards of our shardmanager, according
+  // to the latest configuration. Lock-free, see ownership below.
+  bool keyassignstatus(const string& key) const;
+
+  // rebuilds the store from the snapshot and log at wal_path, then logs every
+  // change from now on
+  void Recover(const std::string& wal_path);
+  // snapshots the store and drops the log segments it covers, if anything
+  // was logged since the last snapshot
+  void TakeSnapshot();
+
+  // copies the primary's store into ours with Dump, resuming where a broken
+  // stream stopped. Called when we become the backup. seq is set to the last
+  // of the primary's changes the copy is sure to have.
+  bool SyncFromPrimary(const std::string& primary, uint64_t* seq);
+  // applies the primary's changes after applied as they come with Replicate,
+  // until the view changes or the primary can't resume our stream
+  void FollowPrimary(const std::string& primary, uint32_t view, uint64_t applied);
 
   // TODO this will be called in a separate thread, here is where you want to
   // ping the shardmanager to get updates about the sharmaster (part 2) and the views changes (part 3)
@@ -90,11 +157,39 @@ class ShardkvServer : public Shardkv::Service {
   std::string shardmanager_address;
   // address of shardmaster sent by the shardmanager
   std::string shardmaster_address;
+  // whether our shardmanager forwards requests to us, as of the last Ping.
+  // Only the primary hands keys over to other servers on a config change.
+  std::atomic<bool> is_primary{false};
+  // as a backup: a copy from the primary is running, and the view in which the
+  // last one completed
+  std::atomic<bool> syncing{false};
+  std::atomic<uint32_t> synced_view{0};
+  // the view as of the last Ping
+  std::atomic<uint32_t> view{0};
+  // the Replicate stream we follow as a backup, cancelled when the view changes
+  std::mutex follow_mutex;
+  std::shared_ptr<::grpc::ClientContext> follow_context;
   std::unique_ptr<Shardmaster::Stub> stub;
-  map<string, string> users;//key, value
-  map<string, post_t> posts;
-  std::unordered_map<std::string, std::vector<shard_t>> other_managers_shard;
-  vector<shard_t> shards_assigned;
+  // channels to the other shardmanagers, for timeline fan-out and migrations
+  ChannelPool channels;
+  // log of the changes to store, null if they are not logged
+  std::unique_ptr<WriteAheadLog> wal;
+  // the latest snapshot of store, and the log's LastSeq() when it was taken
+  std::string snapshot_path;
+  uint64_t snapshot_seq = 0;
+  // the changes to store, numbered for the backup
+  ReplicationLog replication;
+  // users and posts tables, safe to use from any thread
+  KvStore store;
+  // latest configuration (our shards and the other managers' shards), its
+  // version is the shardmaster's config_num. Read on every request, replaced
+  // by the query thread when the config changes.
+  RcuPtr<OwnershipSnapshot> ownership{std::make_unique<const OwnershipSnapshot>(
+      0, vector<shard_t>(), std::unordered_map<std::string, std::vector<shard_t>>())};
+  // timings of the handlers, in the order of the STATS_ indexes, and requests
+  // per key
+  enum : size_t { STATS_GET, STATS_PUT, STATS_APPEND, STATS_DELETE };
+  RpcStats stats{{"Get", "Put", "Append", "Delete"}, MAX_KEY + 1};
 };
 
 #endif  // SHARDING_SHARDKV_H
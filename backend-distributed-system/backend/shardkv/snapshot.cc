@@ -0,0 +1,283 @@
+#include "snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "kvstore.h"
+
+namespace {
+
+constexpr char MAGIC[8] = {'S', 'K', 'V', 'S', 'N', 'A', 'P', '1'};
+
+struct Header {
+    char magic[8];
+    uint64_t first_segment;
+    uint64_t num_users;
+    uint64_t num_posts;
+    uint64_t users_index;
+    uint64_t posts_index;
+};
+
+// buffered writer that keeps track of the file offset
+class Writer {
+public:
+    explicit Writer(const std::string& path) : path(path) {
+        file = fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("cannot create snapshot " + path + ": " + strerror(errno));
+        }
+        setvbuf(file, nullptr, _IOFBF, 1 << 20);
+    }
+    ~Writer() {
+        if (file != nullptr) {
+            fclose(file);
+        }
+    }
+
+    void Put(const void* bytes, size_t len) {
+        if (fwrite(bytes, 1, len, file) != len) {
+            throw std::runtime_error("cannot write snapshot " + path + ": " + strerror(errno));
+        }
+        offset += len;
+    }
+    void PutU64(uint64_t v) {
+        Put(&v, sizeof(v));
+    }
+    void PutString(const std::string& s) {
+        uint32_t len = s.size();
+        Put(&len, sizeof(len));
+        Put(s.data(), s.size());
+    }
+    uint64_t Offset() const {
+        return offset;
+    }
+
+    // rewrites the header at the start of the file, then flushes and fsyncs
+    void Finish(const Header& header) {
+        if (fseek(file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, file) != 1 ||
+            fflush(file) != 0 || fsync(fileno(file)) != 0) {
+            throw std::runtime_error("cannot write snapshot " + path + ": " + strerror(errno));
+        }
+        fclose(file);
+        file = nullptr;
+    }
+
+private:
+    std::string path;
+    FILE* file;
+    uint64_t offset = 0;
+};
+
+}  // namespace
+
+void Snapshot::Write(const KvStore& store, const std::string& path, uint64_t first_segment) {
+    // copied out of a frozen view of the store, then sorted across stripes
+    auto view = store.Freeze();
+    std::vector<std::pair<std::string, std::string>> users;
+    std::vector<std::pair<std::string, post_t>> posts;
+    view->ForEachUser([&users](const std::string& key, const std::string& name) {
+        users.emplace_back(key, name);
+    });
+    view->ForEachPost([&posts](const std::string& key, const post_t& post) {
+        posts.emplace_back(key, post);
+    });
+    std::sort(users.begin(), users.end());
+    std::sort(posts.begin(), posts.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::string tmp = path + ".tmp";
+    Writer out(tmp);
+    Header header{};
+    out.Put(&header, sizeof(header));
+
+    std::vector<uint64_t> user_offsets;
+    user_offsets.reserve(users.size());
+    for (const auto& user : users) {
+        user_offsets.push_back(out.Offset());
+        out.PutString(user.first);
+        out.PutString(user.second);
+    }
+    std::vector<uint64_t> post_offsets;
+    post_offsets.reserve(posts.size());
+    for (const auto& post : posts) {
+        post_offsets.push_back(out.Offset());
+        out.PutString(post.first);
+        out.PutString(post.second.user_id);
+        out.PutString(post.second.content);
+    }
+
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.first_segment = first_segment;
+    header.num_users = users.size();
+    header.num_posts = posts.size();
+    header.users_index = out.Offset();
+    out.Put(user_offsets.data(), user_offsets.size() * sizeof(uint64_t));
+    header.posts_index = out.Offset();
+    out.Put(post_offsets.data(), post_offsets.size() * sizeof(uint64_t));
+    out.Finish(header);
+
+    if (rename(tmp.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("cannot rename snapshot to " + path + ": " + strerror(errno));
+    }
+    size_t slash = path.rfind('/');
+    std::string dir = slash == std::string::npos ? "." : path.substr(0, slash + 1);
+    int dir_fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+}
+
+std::unique_ptr<Snapshot> Snapshot::Open(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return nullptr;
+        }
+        throw std::runtime_error("cannot open snapshot " + path + ": " + strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("cannot stat snapshot " + path + ": " + strerror(errno));
+    }
+    size_t size = st.st_size;
+    if (size < sizeof(Header)) {
+        close(fd);
+        throw std::runtime_error("snapshot " + path + " is truncated");
+    }
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("cannot map snapshot " + path + ": " + strerror(errno));
+    }
+    // loading reads it front to back
+    madvise(mapped, size, MADV_SEQUENTIAL);
+    std::unique_ptr<Snapshot> snapshot(new Snapshot(static_cast<const char*>(mapped), size));
+
+    Header header;
+    memcpy(&header, snapshot->data, sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.users_index > size ||
+        header.posts_index > size ||
+        (size - header.users_index) / sizeof(uint64_t) < header.num_users ||
+        (size - header.posts_index) / sizeof(uint64_t) < header.num_posts) {
+        throw std::runtime_error(path + " is not a valid snapshot");
+    }
+    snapshot->first_segment = header.first_segment;
+    snapshot->num_users = header.num_users;
+    snapshot->num_posts = header.num_posts;
+    snapshot->users_index = header.users_index;
+    snapshot->posts_index = header.posts_index;
+    return snapshot;
+}
+
+Snapshot::Snapshot(const char* data, size_t size) : data(data), size(size) {}
+
+Snapshot::~Snapshot() {
+    munmap(const_cast<char*>(data), size);
+}
+
+uint64_t Snapshot::FirstSegment() const {
+    return first_segment;
+}
+
+size_t Snapshot::NumUsers() const {
+    return num_users;
+}
+
+size_t Snapshot::NumPosts() const {
+    return num_posts;
+}
+
+bool Snapshot::GetUser(const std::string& key, std::string* value) const {
+    uint64_t pos = find(users_index, num_users, key);
+    if (pos == size) {
+        return false;
+    }
+    field(&pos);
+    *value = std::string(field(&pos));
+    return true;
+}
+
+bool Snapshot::GetPost(const std::string& key, post_t* post) const {
+    uint64_t pos = find(posts_index, num_posts, key);
+    if (pos == size) {
+        return false;
+    }
+    field(&pos);
+    post->user_id = std::string(field(&pos));
+    post->content = std::string(field(&pos));
+    return true;
+}
+
+void Snapshot::ForEachUser(const std::function<void(std::string_view, std::string_view)>& fn) const {
+    for (size_t i = 0; i < num_users; i++) {
+        uint64_t pos = recordAt(users_index, i);
+        std::string_view key = field(&pos);
+        std::string_view name = field(&pos);
+        fn(key, name);
+    }
+}
+
+void Snapshot::ForEachPost(
+        const std::function<void(std::string_view, std::string_view, std::string_view)>& fn) const {
+    for (size_t i = 0; i < num_posts; i++) {
+        uint64_t pos = recordAt(posts_index, i);
+        std::string_view key = field(&pos);
+        std::string_view user = field(&pos);
+        std::string_view content = field(&pos);
+        fn(key, user, content);
+    }
+}
+
+std::string_view Snapshot::field(uint64_t* pos) const {
+    uint32_t len;
+    if (*pos > size || size - *pos < sizeof(len)) {
+        throw std::runtime_error("snapshot record out of bounds");
+    }
+    memcpy(&len, data + *pos, sizeof(len));
+    *pos += sizeof(len);
+    if (size - *pos < len) {
+        throw std::runtime_error("snapshot record out of bounds");
+    }
+    std::string_view s(data + *pos, len);
+    *pos += len;
+    return s;
+}
+
+uint64_t Snapshot::recordAt(uint64_t index_start, size_t i) const {
+    uint64_t offset;
+    memcpy(&offset, data + index_start + i * sizeof(uint64_t), sizeof(offset));
+    return offset;
+}
+
+uint64_t Snapshot::find(uint64_t index_start, size_t count, const std::string& key) const {
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint64_t pos = recordAt(index_start, mid);
+        std::string_view mid_key = field(&pos);
+        if (mid_key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == count) {
+        return size;
+    }
+    uint64_t pos = recordAt(index_start, lo);
+    uint64_t record = pos;
+    return field(&pos) == key ? record : size;
+}
@@ -0,0 +1,83 @@
+#ifndef SHARDING_SNAPSHOT_H
+#define SHARDING_SNAPSHOT_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../common/common.h"
+
+class KvStore;
+
+// Image of the users and posts tables on disk, from which a restarting shardkv
+// is rebuilt instead of replaying its whole write-ahead log.
+//
+// The file is laid out to be used in place once mmap'd:
+//
+//   header   "SKVSNAP1", first log segment, #users, #posts, offsets of the
+//            two indexes (u64 each)
+//   users    [u32 len][key][u32 len][name], sorted by key
+//   posts    [u32 len][key][u32 len][author][u32 len][content], sorted by key
+//   indexes  u64 file offset of every user record, then of every post record
+//
+// Lookups binary search the indexes and read the records straight from the
+// mapping; loading walks the records in key order, which lets KvStore::Load
+// append to its maps instead of searching them. Integers are in host byte
+// order, like the log.
+//
+// A snapshot is a view of the store frozen just after the log was rotated, so
+// it holds every change logged before its first segment and possibly a few of
+// the later ones. Replaying the log from that segment on fixes that up, as
+// each change simply overwrites (or deletes) its key.
+class Snapshot {
+public:
+    // Writes store to path through a temporary file that is fsynced and renamed
+    // over it, so a crash leaves either the old snapshot or the new one.
+    // first_segment is the log segment replay has to start from. Throws
+    // std::runtime_error on I/O errors.
+    static void Write(const KvStore& store, const std::string& path, uint64_t first_segment);
+
+    // maps the snapshot at path, nullptr if there is none. Throws
+    // std::runtime_error if it can't be read or is not a valid snapshot.
+    static std::unique_ptr<Snapshot> Open(const std::string& path);
+    ~Snapshot();
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    uint64_t FirstSegment() const;
+    size_t NumUsers() const;
+    size_t NumPosts() const;
+
+    bool GetUser(const std::string& key, std::string* value) const;
+    bool GetPost(const std::string& key, post_t* post) const;
+
+    // visit every user / post in key order. The views point into the mapping
+    // and are only valid during the call.
+    void ForEachUser(const std::function<void(std::string_view key, std::string_view name)>& fn) const;
+    void ForEachPost(const std::function<void(std::string_view key, std::string_view user,
+                                              std::string_view content)>& fn) const;
+
+private:
+    Snapshot(const char* data, size_t size);
+
+    // reads the length-prefixed string at *pos and moves past it. Throws
+    // std::runtime_error if it runs past the end of the file.
+    std::string_view field(uint64_t* pos) const;
+    // offset of the i-th record of the index at index_start
+    uint64_t recordAt(uint64_t index_start, size_t i) const;
+    // position of the record with key in the given index, or size if absent
+    uint64_t find(uint64_t index_start, size_t count, const std::string& key) const;
+
+    const char* data;
+    size_t size;
+    uint64_t first_segment;
+    uint64_t num_users;
+    uint64_t num_posts;
+    uint64_t users_index;
+    uint64_t posts_index;
+};
+
+#endif  // SHARDING_SNAPSHOT_H
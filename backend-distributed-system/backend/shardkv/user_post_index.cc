@@ -0,0 +1,37 @@
+#include "user_post_index.h"
+
+void UserPostIndex::Add(const std::string& user, const std::string& post_key) {
+    posts_by_user[user].insert(post_key);
+}
+
+void UserPostIndex::Remove(const std::string& user, const std::string& post_key) {
+    auto it = posts_by_user.find(user);
+    if (it == posts_by_user.end()) {
+        return;
+    }
+    it->second.erase(post_key);
+    if (it->second.empty()) {
+        posts_by_user.erase(it);
+    }
+}
+
+std::string UserPostIndex::Posts(const std::string& user) const {
+    std::string res;
+    auto it = posts_by_user.find(user);
+    if (it == posts_by_user.end()) {
+        return res;
+    }
+    for (const std::string& post_key : it->second) {
+        res += post_key + ",";
+    }
+    return res;
+}
+
+size_t UserPostIndex::Count(const std::string& user) const {
+    auto it = posts_by_user.find(user);
+    return it == posts_by_user.end() ? 0 : it->second.size();
+}
+
+void UserPostIndex::Clear() {
+    posts_by_user.clear();
+}
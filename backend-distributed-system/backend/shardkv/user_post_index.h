@@ -0,0 +1,34 @@
+#ifndef SHARDING_USER_POST_INDEX_H
+#define SHARDING_USER_POST_INDEX_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+
+// Secondary index from a user key (user_<id>) to the keys of the posts that
+// user wrote on this shardkv. Timeline reads (user_<id>_posts) go through it
+// instead of scanning every post, so they cost O(posts of the user).
+class UserPostIndex {
+public:
+    // records that post_key was written by user
+    void Add(const std::string& user, const std::string& post_key);
+
+    // forgets post_key for user, dropping the user entry once it is empty
+    void Remove(const std::string& user, const std::string& post_key);
+
+    // returns the user's post keys in key order, each followed by a comma
+    // (e.g. "post_1,post_2,"), or an empty string if the user has no posts
+    std::string Posts(const std::string& user) const;
+
+    // number of posts indexed for the user
+    size_t Count(const std::string& user) const;
+
+    void Clear();
+
+private:
+    // a set keeps the keys in the same order the old full scan of the posts
+    // map produced them
+    std::unordered_map<std::string, std::set<std::string>> posts_by_user;
+};
+
+#endif  // SHARDING_USER_POST_INDEX_H
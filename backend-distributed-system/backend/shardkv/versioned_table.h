@@ -0,0 +1,179 @@
+#ifndef SHARDING_VERSIONED_TABLE_H
+#define SHARDING_VERSIONED_TABLE_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One table of a KvStore stripe (users or posts), able to answer as of an
+// earlier point in time. Every value is stamped with the store's clock when it
+// is written; when a value is overwritten or deleted while a point-in-time view
+// that can still see it is open, it is moved to a history instead of being
+// dropped. A view at version V sees the value written at w <= V and replaced at
+// r > V, if there is one.
+//
+// Not thread safe: KvStore calls it with the lock of its stripe held.
+template <typename Value>
+class VersionedTable {
+public:
+    struct Current {
+        Value value;
+        uint64_t written_at;
+    };
+    struct Old {
+        Value value;
+        uint64_t written_at;
+        uint64_t replaced_at;
+    };
+    // key -> its old versions, oldest first
+    using History = std::map<std::string, std::vector<Old>>;
+
+    // the current value of key, nullptr if there is none
+    const Value* Find(const std::string& key) const {
+        auto it = live.find(key);
+        return it == live.end() ? nullptr : &it->second.value;
+    }
+
+    // sets key at time now. The value replaced is kept if the newest open view
+    // (0 if there is none) can see it.
+    void Put(const std::string& key, const Value& value, uint64_t now, uint64_t newest_view) {
+        auto it = live.find(key);
+        if (it == live.end()) {
+            live.emplace(key, Current{value, now});
+            return;
+        }
+        keep(it, now, newest_view);
+        it->second = {value, now};
+    }
+
+    // removes key at time now, false if it was not there
+    bool Erase(const std::string& key, uint64_t now, uint64_t newest_view) {
+        auto it = live.find(key);
+        if (it == live.end()) {
+            return false;
+        }
+        keep(it, now, newest_view);
+        live.erase(it);
+        return true;
+    }
+
+    // adds a key greater than every key in the table, in constant time
+    void Append(std::string key, Value value, uint64_t now) {
+        live.emplace_hint(live.end(), std::move(key), Current{std::move(value), now});
+    }
+
+    // Appends to out the entries seen by the view at version `at` with keys
+    // after `from`, in key order, up to limit of them. Returns true if there
+    // are no more.
+    bool VisibleAfter(const std::string& from, uint64_t at, size_t limit,
+                      std::vector<std::pair<std::string, Value>>* out) const {
+        auto live_it = live.upper_bound(from);
+        auto old_it = history.upper_bound(from);
+        for (size_t found = 0; found < limit;) {
+            bool more_live = live_it != live.end();
+            bool more_old = old_it != history.end();
+            if (!more_live && !more_old) {
+                return true;
+            }
+            const Value* value;
+            if (more_old && (!more_live || old_it->first < live_it->first)) {
+                // deleted since
+                value = visibleOld(old_it->second, at);
+                if (value != nullptr) {
+                    out->emplace_back(old_it->first, *value);
+                    found++;
+                }
+                ++old_it;
+                continue;
+            }
+            bool has_old = more_old && old_it->first == live_it->first;
+            if (live_it->second.written_at <= at) {
+                value = &live_it->second.value;
+            } else {
+                value = has_old ? visibleOld(old_it->second, at) : nullptr;
+            }
+            if (value != nullptr) {
+                out->emplace_back(live_it->first, *value);
+                found++;
+            }
+            ++live_it;
+            if (has_old) {
+                ++old_it;
+            }
+        }
+        return live_it == live.end() && old_it == history.end();
+    }
+
+    // drops the old versions that none of the open views can see
+    void Prune(const std::multiset<uint64_t>& views) {
+        for (auto it = history.begin(); it != history.end();) {
+            auto& versions = it->second;
+            size_t kept = 0;
+            for (size_t i = 0; i < versions.size(); i++) {
+                auto view = views.lower_bound(versions[i].written_at);
+                if (view != views.end() && *view < versions[i].replaced_at) {
+                    if (kept != i) {
+                        versions[kept] = std::move(versions[i]);
+                    }
+                    kept++;
+                }
+            }
+            versions.resize(kept);
+            it = versions.empty() ? history.erase(it) : std::next(it);
+        }
+    }
+
+    // hands over every old version, once no view is open. Taken out so that
+    // they can be freed without the stripe lock.
+    History TakeHistory() {
+        History old;
+        old.swap(history);
+        return old;
+    }
+
+    template <typename Fn>
+    void ForEach(Fn fn) const {
+        for (const auto& entry : live) {
+            fn(entry.first, entry.second.value);
+        }
+    }
+
+    size_t Size() const {
+        return live.size();
+    }
+
+    size_t OldVersions() const {
+        size_t total = 0;
+        for (const auto& entry : history) {
+            total += entry.second.size();
+        }
+        return total;
+    }
+
+private:
+    using Live = std::map<std::string, Current>;
+
+    // moves the value at it to the history if a view may need it
+    void keep(typename Live::iterator it, uint64_t now, uint64_t newest_view) {
+        if (newest_view != 0 && it->second.written_at <= newest_view) {
+            history[it->first].push_back({std::move(it->second.value), it->second.written_at, now});
+        }
+    }
+
+    static const Value* visibleOld(const std::vector<Old>& versions, uint64_t at) {
+        for (const Old& version : versions) {
+            if (version.written_at <= at && at < version.replaced_at) {
+                return &version.value;
+            }
+        }
+        return nullptr;
+    }
+
+    Live live;
+    History history;
+};
+
+#endif  // SHARDING_VERSIONED_TABLE_H
@@ -0,0 +1,303 @@
+#include "wal.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "../common/log.h"
+
+namespace {
+
+uint32_t crc32(const char* data, size_t size) {
+    static const auto table = []() {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void putU32(std::string* out, uint32_t v) {
+    out->append(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+void putString(std::string* out, const std::string& s) {
+    putU32(out, static_cast<uint32_t>(s.size()));
+    out->append(s);
+}
+
+// reads a u32 at *pos of [data, data + size), false if it runs past the end
+bool getU32(const char* data, size_t size, size_t* pos, uint32_t* v) {
+    if (size - *pos < sizeof(*v)) {
+        return false;
+    }
+    memcpy(v, data + *pos, sizeof(*v));
+    *pos += sizeof(*v);
+    return true;
+}
+
+bool getString(const char* data, size_t size, size_t* pos, std::string* s) {
+    uint32_t len;
+    if (!getU32(data, size, pos, &len) || size - *pos < len) {
+        return false;
+    }
+    s->assign(data + *pos, len);
+    *pos += len;
+    return true;
+}
+
+// "dir/" for "dir/file", "." for "file"
+std::string directoryOf(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? "." : path.substr(0, slash + 1);
+}
+
+// A failed write or fdatasync leaves us not knowing what is on disk, and the
+// records were already applied in memory: carrying on would acknowledge writes
+// that may be lost. Stop instead, the log is replayed on restart.
+[[noreturn]] void fail(const char* what) {
+    LOG_ERROR << "write-ahead log: " << what << ": " << strerror(errno);
+    // abort skips the exit handlers
+    FlushLog();
+    std::abort();
+}
+
+}  // namespace
+
+WriteAheadLog::WriteAheadLog(const std::string& path) : path(path) {
+    std::vector<uint64_t> existing = segments(path);
+    segment = existing.empty() ? 1 : existing.back() + 1;
+    openSegment();
+}
+
+WriteAheadLog::~WriteAheadLog() {
+    Sync(LastSeq());
+    close(fd);
+}
+
+uint64_t WriteAheadLog::Append(const WalRecord& record) {
+    std::string payload;
+    payload.push_back(static_cast<char>(record.type));
+    putString(&payload, record.key);
+    putString(&payload, record.value);
+    putString(&payload, record.user);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    putU32(&buffer, static_cast<uint32_t>(payload.size()));
+    putU32(&buffer, crc32(payload.data(), payload.size()));
+    buffer.append(payload);
+    return ++appended_seq;
+}
+
+void WriteAheadLog::Sync(uint64_t seq) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (synced_seq < seq) {
+        if (flushing) {
+            // someone is syncing, our record is in that batch or the next one
+            synced.wait(lock);
+            continue;
+        }
+        // we lead the next batch: everything buffered so far
+        flushing = true;
+        std::string batch;
+        batch.swap(buffer);
+        uint64_t batch_seq = appended_seq;
+        lock.unlock();
+
+        writeBatch(batch);
+
+        lock.lock();
+        synced_seq = batch_seq;
+        syncs++;
+        flushing = false;
+        synced.notify_all();
+    }
+}
+
+uint64_t WriteAheadLog::LastSeq() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return appended_seq;
+}
+
+uint64_t WriteAheadLog::Syncs() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return syncs;
+}
+
+uint64_t WriteAheadLog::Rotate() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (flushing) {
+        synced.wait(lock);
+    }
+    flushing = true;
+    std::string batch;
+    batch.swap(buffer);
+    uint64_t batch_seq = appended_seq;
+    lock.unlock();
+
+    writeBatch(batch);
+    close(fd);
+    segment++;
+    openSegment();
+
+    lock.lock();
+    synced_seq = batch_seq;
+    syncs++;
+    flushing = false;
+    synced.notify_all();
+    return segment;
+}
+
+void WriteAheadLog::DropBefore(uint64_t first_kept) {
+    for (uint64_t old : segments(path)) {
+        if (old < first_kept) {
+            unlink(segmentPath(path, old).c_str());
+        }
+    }
+}
+
+void WriteAheadLog::openSegment() {
+    std::string file = segmentPath(path, segment);
+    fd = open(file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("cannot open log " + file + ": " + strerror(errno));
+    }
+    // the new file's directory entry must survive a crash too
+    int dir_fd = open(directoryOf(path).c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+}
+
+void WriteAheadLog::writeBatch(const std::string& batch) {
+    size_t written = 0;
+    while (written < batch.size()) {
+        ssize_t n = write(fd, batch.data() + written, batch.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fail("write");
+        }
+        written += n;
+    }
+    if (fdatasync(fd) != 0) {
+        fail("fdatasync");
+    }
+}
+
+std::string WriteAheadLog::segmentPath(const std::string& path, uint64_t segment) {
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%08lu", static_cast<unsigned long>(segment));
+    return path + suffix;
+}
+
+std::vector<uint64_t> WriteAheadLog::segments(const std::string& path) {
+    std::string dir = directoryOf(path);
+    std::string prefix = path.substr(path.rfind('/') + 1) + ".";
+
+    std::vector<uint64_t> found;
+    DIR* d = opendir(dir.c_str());
+    if (d == nullptr) {
+        return found;
+    }
+    while (struct dirent* entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        std::string number = name.substr(prefix.size());
+        if (std::all_of(number.begin(), number.end(), ::isdigit)) {
+            found.push_back(std::stoull(number));
+        }
+    }
+    closedir(d);
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+size_t WriteAheadLog::Replay(const std::string& path, uint64_t first_segment,
+                             const std::function<void(const WalRecord&)>& apply) {
+    size_t count = 0;
+    for (uint64_t segment : segments(path)) {
+        if (segment >= first_segment) {
+            count += replaySegment(segmentPath(path, segment), apply);
+        }
+    }
+    return count;
+}
+
+size_t WriteAheadLog::replaySegment(const std::string& path, const std::function<void(const WalRecord&)>& apply) {
+    int in = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        throw std::runtime_error("cannot open log " + path + ": " + strerror(errno));
+    }
+    std::string log;
+    char chunk[1 << 16];
+    ssize_t n;
+    while ((n = read(in, chunk, sizeof(chunk))) != 0) {
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(in);
+            throw std::runtime_error("cannot read log " + path + ": " + strerror(errno));
+        }
+        log.append(chunk, n);
+    }
+    close(in);
+
+    const char* data = log.data();
+    size_t pos = 0;
+    size_t count = 0;
+    while (pos < log.size()) {
+        size_t record_start = pos;
+        uint32_t len, crc;
+        if (!getU32(data, log.size(), &pos, &len) || !getU32(data, log.size(), &pos, &crc) ||
+            len < 1 || log.size() - pos < len || crc32(data + pos, len) != crc) {
+            pos = record_start;
+            break;
+        }
+        const char* payload = data + pos;
+        size_t payload_pos = 1;
+        WalRecord record;
+        record.type = static_cast<WalRecord::Type>(payload[0]);
+        if (!getString(payload, len, &payload_pos, &record.key) ||
+            !getString(payload, len, &payload_pos, &record.value) ||
+            !getString(payload, len, &payload_pos, &record.user)) {
+            pos = record_start;
+            break;
+        }
+        pos += len;
+        apply(record);
+        count++;
+    }
+
+    if (pos < log.size()) {
+        LOG_WARNING << "write-ahead log: dropping " << log.size() - pos << " bytes of torn tail from " << path;
+        if (truncate(path.c_str(), pos) != 0) {
+            throw std::runtime_error("cannot truncate log " + path + ": " + strerror(errno));
+        }
+    }
+    return count;
+}
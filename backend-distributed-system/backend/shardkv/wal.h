@@ -0,0 +1,106 @@
+#ifndef SHARDING_WAL_H
+#define SHARDING_WAL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// One change to the users or posts table.
+struct WalRecord {
+    enum class Type : uint8_t {
+        PUT_USER = 1,
+        PUT_POST = 2,
+        DELETE_USER = 3,
+        DELETE_POST = 4,
+    };
+    Type type;
+    std::string key;
+    // name of the user, or content of the post
+    std::string value;
+    // author of the post
+    std::string user;
+};
+
+// Append-only write-ahead log of the shardkv's tables.
+//
+// Writing is split in two so that a record can be appended while the caller
+// still holds the lock that orders it, and waited on after that lock is
+// released: Append copies the record into an in-memory buffer and returns its
+// sequence number, Sync(seq) returns once that record is on disk.
+//
+// Sync does group commit. The first thread to find unsynced records writes the
+// whole buffer and issues one fdatasync for it; threads arriving meanwhile only
+// wait for that flush, or for the next one if their record came after it. Under
+// load one fdatasync covers many writers instead of one per RPC.
+//
+// The log is a sequence of numbered segment files, path.00000001,
+// path.00000002, ... Rotate() starts a new segment so that a snapshot of the
+// store can replace the ones before it (see snapshot.h).
+//
+// On disk every record is [payload length][crc32 of payload][payload], the
+// payload being the type followed by key, value and user, each prefixed by its
+// 32 bit length. Integers are in host byte order: a log is only ever read back
+// by the machine that wrote it.
+class WriteAheadLog {
+public:
+    // starts a new segment after the ones already at path. Throws
+    // std::runtime_error if it can't be created.
+    explicit WriteAheadLog(const std::string& path);
+    ~WriteAheadLog();
+
+    WriteAheadLog(const WriteAheadLog&) = delete;
+    WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+
+    // buffers record, returns its sequence number (1 for the first record)
+    uint64_t Append(const WalRecord& record);
+    // returns once every record up to seq is durable
+    void Sync(uint64_t seq);
+    // sequence number of the last record appended
+    uint64_t LastSeq() const;
+    // number of fdatasync calls so far
+    uint64_t Syncs() const;
+
+    // makes everything appended so far durable and moves on to a new segment,
+    // whose number is returned. Later records go to the new segment.
+    uint64_t Rotate();
+    // deletes the segments numbered below segment
+    void DropBefore(uint64_t segment);
+
+    // Calls apply on every record of the segments at path numbered from
+    // first_segment on, in order, and returns how many there were. A torn or
+    // corrupt tail, left by a crash in the middle of a write, ends the segment
+    // and is cut off the file. No segments is an empty log.
+    static size_t Replay(const std::string& path, uint64_t first_segment,
+                         const std::function<void(const WalRecord&)>& apply);
+
+private:
+    // numbers of the segments at path, in order
+    static std::vector<uint64_t> segments(const std::string& path);
+    static std::string segmentPath(const std::string& path, uint64_t segment);
+    static size_t replaySegment(const std::string& path, const std::function<void(const WalRecord&)>& apply);
+    void openSegment();
+    // writes batch to the current segment and fdatasyncs it, called by the
+    // thread that is flushing
+    void writeBatch(const std::string& batch);
+
+    const std::string path;
+    // current segment and its file, only touched by the flushing thread
+    uint64_t segment;
+    int fd;
+
+    mutable std::mutex mutex;
+    std::condition_variable synced;
+    // encoded records not yet handed to a flush
+    std::string buffer;
+    // last sequence number appended / on disk
+    uint64_t appended_seq = 0;
+    uint64_t synced_seq = 0;
+    // a thread is writing and syncing a batch, the others wait for it
+    bool flushing = false;
+    uint64_t syncs = 0;
+};
+
+#endif  // SHARDING_WAL_H
@@ -3,6 +3,7 @@
 #include <cstdio>
 
 #include "shardkv_manager.h"
+#include "../common/log.h"
 
 int main(int argc, char** argv) {
   if (argc != 4) {
@@ -20,10 +21,10 @@ int main(int argc, char** argv) {
   std::string port(argv[1]);
   std::string addr = hostname + ":" + port;
 
-  fprintf(stdout, "Listening on: %s\n", addr.c_str());
+  LOG_INFO << "Listening on: " << addr;
   std::string shardmaster_addr =
       std::string(argv[2]) + ":" + std::string(argv[3]);
-  fprintf(stdout, "Shardmaster on: %s\n", shardmaster_addr.c_str());
+  LOG_INFO << "Shardmaster on: " << shardmaster_addr;
 
   ::grpc::ServerBuilder builder;
   builder.AddListeningPort(addr, ::grpc::InsecureServerCredentials());
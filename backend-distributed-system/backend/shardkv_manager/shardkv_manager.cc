@@ -1,6 +1,56 @@
 #include <grpcpp/grpcpp.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include "shardkv_manager.h"
+#include "../common/log.h"
+
+// phi past which a server is taken for dead: a 1 in 10^8 chance that it was
+// only slow
+constexpr double PHI_THRESHOLD = 8;
+// intervals needed before a server's own history is trusted; until then its
+// pings are expected every PING_PERIOD_MS (what the shardkv uses)
+constexpr size_t MIN_PINGS = 3;
+constexpr double PING_PERIOD_MS = 100;
+// floor for the spread of the intervals, so that a very regular server isn't
+// dropped on the first hiccup
+constexpr double MIN_STDDEV_MS = 25;
+// added to the mean interval: a scheduling stall this long is not suspicious
+constexpr double ACCEPTABLE_PAUSE_MS = 150;
+
+void PingInterval::Push(std::chrono::steady_clock::time_point t) {
+    if (pinged) {
+        double interval = std::chrono::duration<double, std::milli>(t - last).count();
+        if (count == PING_HISTORY) {
+            sum -= intervals[next];
+            sum_squares -= intervals[next] * intervals[next];
+        } else {
+            count++;
+        }
+        intervals[next] = interval;
+        next = (next + 1) % PING_HISTORY;
+        sum += interval;
+        sum_squares += interval * interval;
+    }
+    last = t;
+    pinged = true;
+}
+
+double PingInterval::Phi(std::chrono::steady_clock::time_point now) const {
+    double mean = PING_PERIOD_MS;
+    double stddev = MIN_STDDEV_MS;
+    if (count >= MIN_PINGS) {
+        mean = sum / count;
+        stddev = std::max(stddev, std::sqrt(std::max(0.0, sum_squares / count - mean * mean)));
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(now - last).count();
+    double y = (elapsed - mean - ACCEPTABLE_PAUSE_MS) / stddev;
+    // chance that an interval is longer than elapsed; phi is infinite once it
+    // underflows
+    double later = 0.5 * std::erfc(y / std::sqrt(2.0));
+    return -std::log10(later);
+}
 
 /**
  * This method is analogous to a hashmap lookup. A key is supplied in the
@@ -15,27 +65,25 @@
  * ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "<your error message
  * here>")
  */
-::grpc::Status ShardkvManager::Get(::grpc::ServerContext* context,
-                                  const ::GetRequest* req,
-                                  ::GetResponse* res) {
-    cout << "Manager Get: Key - " << req->key() << endl;
-    grpc::ClientContext cc;
-    GetRequest request;
-    request.set_key(req->key());
-    GetResponse response;
-
-    auto channel = grpc::CreateChannel(shardkv_address, grpc::InsecureChannelCredentials());
-    auto kvStub = Shardkv::NewStub(channel);
-    auto status = kvStub->Get(&cc, request, &response);
-
-    if(status.ok()) {
-        cout << "Manager Get: Successful" << endl;
-        res->set_data(response.data());
-        return ::grpc::Status(::grpc::Status::OK);
-    } else {
-        logError("Get", status);
-        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Get failed: " + status.error_message());
-    }
+::grpc::ServerUnaryReactor* ShardkvManager::Get(::grpc::CallbackServerContext* context,
+                                                const ::GetRequest* req,
+                                                ::GetResponse* res) {
+    LOG_DEBUG << "Manager Get: Key - " << req->key();
+    auto* reactor = context->DefaultReactor();
+    ForwardedCall* call = forward(context);
+    // the shardkv's answer is written straight into ours
+    call->stub->async()->Get(call->cc.get(), req, res, [this, call, reactor](::grpc::Status status) {
+        stats.Record(STATS_GET, std::chrono::steady_clock::now() - call->start, status.ok());
+        if (status.ok()) {
+            LOG_DEBUG << "Manager Get: Successful";
+            reactor->Finish(::grpc::Status::OK);
+        } else {
+            logError("Get", status);
+            reactor->Finish(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Get failed: " + status.error_message()));
+        }
+        delete call;
+    });
+    return reactor;
 }
 
 /**
@@ -52,28 +100,23 @@
  * ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "<your error message
  * here>")
  */
-::grpc::Status ShardkvManager::Put(::grpc::ServerContext* context,
-                                  const ::PutRequest* req,
-                                  Empty* res) {
-    cout << "Manager Put: Key - " << req->key() << ", Data - " << req->data() << ", User - " << req->user() << endl;
-    grpc::ClientContext cc;
-    PutRequest request;
-    request.set_key(req->key());
-    request.set_data(req->data());
-    request.set_user(req->user());
-    Empty response;
-
-    auto channel = grpc::CreateChannel(shardkv_address, grpc::InsecureChannelCredentials());
-    auto kvStub = Shardkv::NewStub(channel);
-    auto status = kvStub->Put(&cc, request, &response);
-
-    if(status.ok()) {
-        cout << "Manager Put: Successful" << endl;
-    } else {
-        logError("Put", status);
-    }
-
-    return ::grpc::Status(::grpc::Status::OK);
+::grpc::ServerUnaryReactor* ShardkvManager::Put(::grpc::CallbackServerContext* context,
+                                                const ::PutRequest* req,
+                                                Empty* res) {
+    LOG_DEBUG << "Manager Put: Key - " << req->key() << ", Data - " << req->data() << ", User - " << req->user();
+    auto* reactor = context->DefaultReactor();
+    ForwardedCall* call = forward(context);
+    call->stub->async()->Put(call->cc.get(), req, res, [this, call, reactor](::grpc::Status status) {
+        stats.Record(STATS_PUT, std::chrono::steady_clock::now() - call->start, status.ok());
+        if (status.ok()) {
+            LOG_DEBUG << "Manager Put: Successful";
+        } else {
+            logError("Put", status);
+        }
+        reactor->Finish(::grpc::Status::OK);
+        delete call;
+    });
+    return reactor;
 }
 
 
@@ -90,27 +133,23 @@
  * ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "<your error message
  * here>"
  */
-::grpc::Status ShardkvManager::Append(::grpc::ServerContext* context,
-                                     const ::AppendRequest* req,
-                                     Empty* res) {
-    cout << "Manager Append: Key - " << req->key() << ", Data - " << req->data() << endl;
-    grpc::ClientContext cc;
-    AppendRequest request;
-    request.set_key(req->key());
-    request.set_data(req->data());
-    Empty response;
-
-    auto channel = grpc::CreateChannel(shardkv_address, grpc::InsecureChannelCredentials());
-    auto kvStub = Shardkv::NewStub(channel);
-    auto status = kvStub->Append(&cc, request, &response);
-
-    if(status.ok()) {
-        cout << "Manager Append: Successful" << endl;
-    } else {
-        logError("Append", status);
-    }
-
-    return ::grpc::Status(::grpc::Status::OK);
+::grpc::ServerUnaryReactor* ShardkvManager::Append(::grpc::CallbackServerContext* context,
+                                                   const ::AppendRequest* req,
+                                                   Empty* res) {
+    LOG_DEBUG << "Manager Append: Key - " << req->key() << ", Data - " << req->data();
+    auto* reactor = context->DefaultReactor();
+    ForwardedCall* call = forward(context);
+    call->stub->async()->Append(call->cc.get(), req, res, [this, call, reactor](::grpc::Status status) {
+        stats.Record(STATS_APPEND, std::chrono::steady_clock::now() - call->start, status.ok());
+        if (status.ok()) {
+            LOG_DEBUG << "Manager Append: Successful";
+        } else {
+            logError("Append", status);
+        }
+        reactor->Finish(::grpc::Status::OK);
+        delete call;
+    });
+    return reactor;
 }
 
 /**
@@ -125,34 +164,35 @@
  * ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "<your error message
  * here>")
  */
-::grpc::Status ShardkvManager::Delete(::grpc::ServerContext* context,
-                                           const ::DeleteRequest* req,
-                                           Empty* res) {
-    cout << "Manager Delete: Key - " << req->key() << endl;
-    grpc::ClientContext cc;
-    DeleteRequest request;
-    request.set_key(req->key());
-    Empty response;
-
-    auto channel = grpc::CreateChannel(shardkv_address, grpc::InsecureChannelCredentials());
-    auto kvStub = Shardkv::NewStub(channel);
-    auto status = kvStub->Delete(&cc, request, &response);
-
-    if(status.ok()) {
-        cout << "Manager Delete: Successful" << endl;
-    } else {
-        logError("Delete", status);
-    }
-
-    return ::grpc::Status(::grpc::Status::OK);
+::grpc::ServerUnaryReactor* ShardkvManager::Delete(::grpc::CallbackServerContext* context,
+                                                   const ::DeleteRequest* req,
+                                                   Empty* res) {
+    LOG_DEBUG << "Manager Delete: Key - " << req->key();
+    auto* reactor = context->DefaultReactor();
+    ForwardedCall* call = forward(context);
+    call->stub->async()->Delete(call->cc.get(), req, res, [this, call, reactor](::grpc::Status status) {
+        stats.Record(STATS_DELETE, std::chrono::steady_clock::now() - call->start, status.ok());
+        if (status.ok()) {
+            LOG_DEBUG << "Manager Delete: Successful";
+        } else {
+            logError("Delete", status);
+        }
+        reactor->Finish(::grpc::Status::OK);
+        delete call;
+    });
+    return reactor;
 }
 
 
 /**
- * In part 2, this function get address of the server sending the Ping request, who became the primary server to which the
- * shardmanager will forward Get, Put, Append and Delete requests. It answer with the name of the shardmaster containeing
+ * In part 2, this function get address of the server sending the Ping request. The first server to ping becomes the
+ * primary, to which the shardmanager will forward Get, Put, Append and Delete requests, and the next one the backup,
+ * which copies the primary's data. It answer with the current view and the name of the shardmaster containeing
  * the information about the distribution.
  *
+ * Every ping is also recorded for the failure detector (see checkHeartbeats). The backup sends the number of the
+ * view it has caught up with, which makes it eligible to replace the primary.
+ *
  * @param context - you can ignore this
  * @param request A message containing the name of the server sending the request, the number of the view acknowledged
  * @param response The current view and the name of the shardmaster
@@ -162,8 +202,146 @@
  */
 ::grpc::Status ShardkvManager::Ping(::grpc::ServerContext* context, const PingRequest* req,
                                        ::PingResponse* res){
-    shardkv_address = req->server();
+    RpcTimer timer(stats, STATS_PING);
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::string& server = req->server();
+    pings[server].Push(std::chrono::steady_clock::now());
+    if (primary.empty()) {
+        primary = server;
+        view_number++;
+    } else if (backup.empty() && server != primary) {
+        backup = server;
+        backup_ready = false;
+        view_number++;
+        // connect now, so that promoting it doesn't wait on a handshake
+        channels.Get(backup);
+    } else if (server == backup && req->viewnumber() == view_number) {
+        backup_ready = true;
+    }
+    res->set_id(view_number);
+    res->set_primary(primary);
+    res->set_backup(backup);
     res->set_shardmaster(sm_address);
-    return ::grpc::Status(::grpc::StatusCode::OK, "Success");
+    return timer.Done(::grpc::Status(::grpc::StatusCode::OK, "Success"));
+}
+
+/**
+ * Runs every HEARTBEAT_CHECK_INTERVAL. A backup that stopped pinging is dropped
+ * and the next server to ping takes its place. A primary that stopped pinging
+ * is replaced by the backup, if the backup has acked the current view, i.e.
+ * finished copying the primary and follows its writes; otherwise the primary
+ * holds the only full copy of the data and we wait for it to come back.
+ * Either way the view number goes up, which tells the servers to start over
+ * from the new view.
+ */
+void ShardkvManager::checkHeartbeats() {
+    auto now = std::chrono::steady_clock::now();
+    std::string dead_primary;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto suspected = [&](const std::string& server) {
+            auto it = pings.find(server);
+            return it != pings.end() && it->second.Phi(now) > PHI_THRESHOLD;
+        };
+        if (!backup.empty() && suspected(backup)) {
+            LOG_WARNING << "backup " << backup << " stopped pinging " << pings[backup].GetPingInterval(now)
+                        << " ms ago, dropping it";
+            pings.erase(backup);
+            backup.clear();
+            backup_ready = false;
+            view_number++;
+        }
+        if (!primary.empty() && backup_ready && suspected(primary)) {
+            LOG_WARNING << "primary " << primary << " stopped pinging " << pings[primary].GetPingInterval(now)
+                        << " ms ago, promoting " << backup;
+            pings.erase(primary);
+            dead_primary = primary;
+            primary = backup;
+            backup.clear();
+            backup_ready = false;
+            view_number++;
+        }
+        // servers waiting for a place in the view start with a fresh history
+        // if they go quiet
+        for (auto it = pings.begin(); it != pings.end();) {
+            if (it->first != primary && it->first != backup && it->second.Phi(now) > PHI_THRESHOLD) {
+                it = pings.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    if (!dead_primary.empty()) {
+        channels.Refresh(dead_primary);
+    }
+}
+
+ShardkvManager::ForwardedCall* ShardkvManager::forward(::grpc::CallbackServerContext* context) {
+    return new ForwardedCall{grpc::ClientContext::FromCallbackServerContext(*context), shardkvStub(),
+                             std::chrono::steady_clock::now()};
+}
+
+std::unique_ptr<Shardkv::Stub> ShardkvManager::shardkvStub() {
+    std::string address;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        address = primary;
+    }
+    return Shardkv::NewStub(channels.Get(address));
+}
+
+
+
+/**
+ * Relays a MigrateRange stream to the shardkv we manage. Batches and acks are
+ * forwarded as they come, so the flow control of the sender works end to end.
+ *
+ * @param context - used to pass the deadline and cancellation on
+ * @param stream the batches from the previous owner, the acks back to it
+ * @return the status of the shardkv's side of the stream
+ */
+::grpc::Status ShardkvManager::MigrateRange(::grpc::ServerContext* context,
+                                            ::grpc::ServerReaderWriter<::MigrateAck, ::MigrateBatch>* stream) {
+    auto cc = grpc::ClientContext::FromServerContext(*context);
+    auto kvStub = shardkvStub();
+    auto upstream = kvStub->MigrateRange(cc.get());
+
+    // acks go back on their own thread so they overlap with the batches
+    std::thread acks([&]() {
+        MigrateAck ack;
+        while (upstream->Read(&ack)) {
+            if (!stream->Write(ack)) {
+                break;
+            }
+        }
+    });
+    MigrateBatch batch;
+    while (stream->Read(&batch)) {
+        if (!upstream->Write(batch)) {
+            break;
+        }
+    }
+    upstream->WritesDone();
+    acks.join();
+
+    auto status = upstream->Finish();
+    if (!status.ok()) {
+        logError("MigrateRange", status);
+    }
+    return status;
 }
 
+/**
+ * Latencies of the requests we forwarded, from when they came in to the
+ * shardkv's answer, and of the pings.
+ *
+ * @param context - you can ignore this
+ * @param request - empty
+ * @param response the count, errors and latency percentiles of each method
+ * @return ::grpc::Status::OK
+ */
+::grpc::Status ShardkvManager::Stats(::grpc::ServerContext* context, const Empty* request,
+                                     ::StatsResponse* response) {
+    stats.Fill(response);
+    return ::grpc::Status::OK;
+}
@@ -2,8 +2,12 @@
 #define SHARDING_SHARDKV_MANAGER_H
 
 #include <grpcpp/grpcpp.h>
+#include <array>
+#include <chrono>
 #include <thread>
 #include "../common/common.h"
+#include "../common/channel_pool.h"
+#include "../common/rpc_stats.h"
 #include <unordered_map>
 #include <mutex>
 #include <iostream>
@@ -13,50 +17,85 @@
 #include "../build/shardmaster.grpc.pb.h"
 using grpc::Status;
 
+// pings of a server remembered by its failure detector
+constexpr size_t PING_HISTORY = 100;
+
+// Ping arrival history of one shardkv, for a phi-accrual failure detector
+// (Hayashibara et al.). Rather than a fixed timeout, the time since the last
+// ping is weighed against the intervals seen so far, taken as normally
+// distributed: Phi is -log10 of the chance that the next ping is still to come
+// after that long. A server pinging steadily is suspected soon after it stops,
+// one whose pings jitter only after a proportionally longer silence.
 class PingInterval {
-    std::chrono::time_point<std::chrono::system_clock> time;
 public:
-    std::uint64_t GetPingInterval(){
-        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()-time.time_since_epoch()).count();
-    };
-    void Push(std::chrono::time_point<std::chrono::system_clock> t){
-        time = t;
+    // milliseconds since the last ping
+    std::uint64_t GetPingInterval(std::chrono::steady_clock::time_point now) const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(now - last).count();
     }
+    void Push(std::chrono::steady_clock::time_point t);
+    double Phi(std::chrono::steady_clock::time_point now) const;
+
+private:
+    std::chrono::steady_clock::time_point last;
+    bool pinged = false;
+    // the last PING_HISTORY intervals in ms, oldest overwritten first, with
+    // their running sum and sum of squares
+    std::array<double, PING_HISTORY> intervals{};
+    size_t count = 0;
+    size_t next = 0;
+    double sum = 0;
+    double sum_squares = 0;
 };
 
-class ShardkvManager : public Shardkv::Service {
+// connections opened to the shardkv, requests are spread over them
+constexpr size_t SHARDKV_CONNECTIONS = 4;
+// how often the failure detector looks at the servers' pings
+constexpr std::chrono::milliseconds HEARTBEAT_CHECK_INTERVAL(20);
+
+// Get/Put/Append/Delete are served with the callback API: a request is turned
+// into an async call to the shardkv and finished from that call's completion,
+// so no thread waits on the shardkv and the number of requests in flight isn't
+// bounded by a thread pool. Ping and MigrateRange stay synchronous.
+using ShardkvManagerBase = Shardkv::WithCallbackMethod_Get<
+    Shardkv::WithCallbackMethod_Put<
+        Shardkv::WithCallbackMethod_Append<
+            Shardkv::WithCallbackMethod_Delete<Shardkv::Service>>>>;
+
+class ShardkvManager : public ShardkvManagerBase {
   using Empty = google::protobuf::Empty;
 
  public:
   explicit ShardkvManager(std::string addr, const std::string& shardmaster_addr)
       : address(std::move(addr)), sm_address(shardmaster_addr) {
-      // TODO: Part 3
       // This thread will check for last shardkv server ping and update the view accordingly if needed
       std::thread heartbeatChecker(
               [this]() {
-                  std::chrono::milliseconds timespan(1000);
                   while (true) {
-                      std::this_thread::sleep_for(timespan);
+                      std::this_thread::sleep_for(HEARTBEAT_CHECK_INTERVAL);
+                      checkHeartbeats();
                   }
               });
       // We detach the thread so we don't have to wait for it to terminate later
       heartbeatChecker.detach();
   };
 
-  // TODO implement these three methods
-  ::grpc::Status Get(::grpc::ServerContext* context,
-                     const ::GetRequest* request,
-                     ::GetResponse* response) override;
-  ::grpc::Status Put(::grpc::ServerContext* context,
-                     const ::PutRequest* request, Empty* response) override;
-  ::grpc::Status Append(::grpc::ServerContext* context,
-                        const ::AppendRequest* request,
-                        Empty* response) override;
-  ::grpc::Status Delete(::grpc::ServerContext* context,
-                        const ::DeleteRequest* request,
-                        Empty* response) override;
+  ::grpc::ServerUnaryReactor* Get(::grpc::CallbackServerContext* context,
+                                  const ::GetRequest* request,
+                                  ::GetResponse* response) override;
+  ::grpc::ServerUnaryReactor* Put(::grpc::CallbackServerContext* context,
+                                  const ::PutRequest* request, Empty* response) override;
+  ::grpc::ServerUnaryReactor* Append(::grpc::CallbackServerContext* context,
+                                     const ::AppendRequest* request,
+                                     Empty* response) override;
+  ::grpc::ServerUnaryReactor* Delete(::grpc::CallbackServerContext* context,
+                                     const ::DeleteRequest* request,
+                                     Empty* response) override;
   ::grpc::Status Ping(::grpc::ServerContext* context, const PingRequest* request,
                         ::PingResponse* response) override;
+  ::grpc::Status MigrateRange(::grpc::ServerContext* context,
+                              ::grpc::ServerReaderWriter<::MigrateAck, ::MigrateBatch>* stream) override;
+  ::grpc::Status Stats(::grpc::ServerContext* context, const Empty* request,
+                       ::StatsResponse* response) override;
 
  private:
     // address we're running on (hostname:port)
@@ -64,6 +103,41 @@ class ShardkvManager : public Shardkv::Service {
 
     // shardmaster address
     std::string sm_address;
-    std::string shardkv_address;
+    // The view: the shardkv requests are forwarded to, the one that mirrors it,
+    // and a number bumped whenever either changes. The first shardkv to ping
+    // becomes the primary, the next one the backup.
+    std::string primary;
+    std::string backup;
+    uint32_t view_number = 0;
+    // the backup pinged with the current view number: it has copied the
+    // primary and follows it, so it can take over
+    bool backup_ready = false;
+    // ping history of every server that pings us
+    std::unordered_map<std::string, PingInterval> pings;
+    // guards the view and the pings, which Ping updates while requests are
+    // forwarded
+    std::mutex mutex;
+    // connections to the primary, dropped when another one takes its place
+    ChannelPool channels{SHARDKV_CONNECTIONS};
+    // timings of the forwarded requests (from ours to the shardkv's answer)
+    // and of Ping, in the order of the STATS_ indexes
+    enum : size_t { STATS_GET, STATS_PUT, STATS_APPEND, STATS_DELETE, STATS_PING };
+    RpcStats stats{{"Get", "Put", "Append", "Delete", "Ping"}};
+
+    // drops the servers the failure detector suspects from the view, promoting
+    // the backup if the primary is gone
+    void checkHeartbeats();
+
+    // a stub on one of the pooled channels to the primary
+    std::unique_ptr<Shardkv::Stub> shardkvStub();
+
+    // the outbound half of a forwarded request, freed when the shardkv answers.
+    // Its context carries the caller's deadline and cancellation.
+    struct ForwardedCall {
+        std::unique_ptr<grpc::ClientContext> cc;
+        std::unique_ptr<Shardkv::Stub> stub;
+        std::chrono::steady_clock::time_point start;
+    };
+    ForwardedCall* forward(::grpc::CallbackServerContext* context);
 };
 #endif  // SHARDING_SHARDKV_MANAGER_H
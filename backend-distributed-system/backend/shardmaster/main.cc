@@ -1,6 +1,7 @@
 #include <unistd.h>
 #include <cstdio>
 #include "shardmaster.h"
+#include "../common/log.h"
 
 int main(int argc, char** argv) {
   if (argc != 2) {
@@ -19,7 +20,7 @@ int main(int argc, char** argv) {
   builder.AddListeningPort(addr, ::grpc::InsecureServerCredentials());
   builder.RegisterService(&shardmaster);
   std::unique_ptr<::grpc::Server> server = builder.BuildAndStart();
-  fprintf(stdout, "Listening on: %s\n", addr.c_str());
+  LOG_INFO << "Listening on: " << addr;
   server->Wait();
   return 0;
 }
@@ -1,4 +1,5 @@
 #include "shardmaster.h"
+#include "../common/log.h"
 #include <vector>
 
 /**
@@ -20,6 +21,7 @@
 ::grpc::Status StaticShardmaster::Join(::grpc::ServerContext* context,
                                        const ::JoinRequest* request,
                                        Empty* response) {
+    RpcTimer timer(stats, STATS_JOIN);
     
     // Lock the mutex to ensure thread safety
     std::unique_lock<std::mutex> lock(this-> mutex);
@@ -27,7 +29,7 @@
     // Check if the server already exists in the configuration
     if (this->server_shards_map.find(request->server()) != this->server_shards_map.end()) {
         lock.unlock();
-        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Server already exists in the configuration");
+        return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Server already exists in the configuration"));
     }
     this->server_list.push_back(request->server());
     for (auto& server : this->server_list) {
@@ -35,8 +37,9 @@
     }
     bool add = true;
     resizeShards(server_list, server_shards_map,add);
+    configChanged();
     lock.unlock();
-    return ::grpc::Status::OK;
+    return timer.Done(::grpc::Status::OK);
 }
 
 
@@ -59,21 +62,23 @@
 ::grpc::Status StaticShardmaster::Leave(::grpc::ServerContext* context,
                                         const ::LeaveRequest* request,
                                         Empty* response) {
+    RpcTimer timer(stats, STATS_LEAVE);
 
     std::unique_lock<std::mutex> lock(this-> mutex);
     for (int i = 0; i < request->servers_size(); i++) {
         if (this->server_shards_map.find(request->servers(i)) == this->server_shards_map.end()) {
             lock.unlock();
-            return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "The given server does not exist!");
+            return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "The given server does not exist!"));
         }
         this->server_shards_map.erase(request->servers(i));
         this->server_list.erase(std::find(this->server_list.begin(), this->server_list.end(), request->servers(i)));
     }
     bool add = false;
     resizeShards(server_list, server_shards_map,add);
+    configChanged();
 
     lock.unlock();
-    return ::grpc::Status::OK;
+    return timer.Done(::grpc::Status::OK);
 }
 /**
  * Move the specified shard to the target server (passed in MoveRequest) in the
@@ -93,10 +98,11 @@
 ::grpc::Status StaticShardmaster::Move(::grpc::ServerContext* context,
                                        const ::MoveRequest* request,
                                        Empty* response) {
+    RpcTimer timer(stats, STATS_MOVE);
     std::unique_lock<std::mutex> lock(this->mutex);
     if (this->server_shards_map.find(request->server()) == this->server_shards_map.end()) {
         lock.unlock();
-        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Server doesn't exist. Move Error!");
+        return timer.Done(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, "Server doesn't exist. Move Error!"));
     }
     shard_t moved_shard;
     shard_t new_shard;
@@ -132,9 +138,10 @@
     }
     this->server_shards_map[request->server()].push_back(moved_shard);
     sortAscendingInterval(this->server_shards_map[request->server()]);
+    configChanged();
 
     lock.unlock();
-    return ::grpc::Status::OK;
+    return timer.Done(::grpc::Status::OK);
 }
 /**
  * When this function is called, you should store the current servers and their
@@ -153,7 +160,52 @@
 ::grpc::Status StaticShardmaster::Query(::grpc::ServerContext* context,
                                         const StaticShardmaster::Empty* request,
                                         ::QueryResponse* response) {
+    RpcTimer timer(stats, STATS_QUERY);
+    std::unique_lock<std::mutex> lock(this->mutex);
+    fillConfig(response);
+    lock.unlock();
+    return timer.Done(::grpc::Status::OK);
+}
+
+/**
+ * Streams the configuration to a watcher (typically a shardkv) instead of
+ * having it poll Query. A config is written as soon as one newer than
+ * since_config_num exists, then again after every Join/Leave/Move, so an idle
+ * shardmaster does no work for its watchers. Configs that change several times
+ * while a write is in flight are coalesced into the latest one.
+ *
+ * @param context used to notice the watcher going away
+ * @param request the config number the watcher already has
+ * @param writer the stream the configs are written to
+ * @return ::grpc::Status::OK once the watcher is gone
+ */
+::grpc::Status StaticShardmaster::Watch(::grpc::ServerContext* context,
+                                        const ::WatchRequest* request,
+                                        ::grpc::ServerWriter<::QueryResponse>* writer) {
+    uint64_t sent = request->since_config_num();
     std::unique_lock<std::mutex> lock(this->mutex);
+    while (!context->IsCancelled()) {
+        if (this->config_num == sent) {
+            // wake up now and then to notice a watcher that went away
+            this->config_changed.wait_for(lock, std::chrono::seconds(1));
+            continue;
+        }
+        ::QueryResponse response;
+        fillConfig(&response);
+        sent = response.config_num();
+
+        // don't hold up Join/Leave/Move on a slow watcher
+        lock.unlock();
+        if (!writer->Write(response)) {
+            break;
+        }
+        lock.lock();
+    }
+    return ::grpc::Status::OK;
+}
+
+void StaticShardmaster::fillConfig(::QueryResponse* response) {
+    response->set_config_num(this->config_num);
     for (const auto& currentServer : this->server_list) {
         auto currentConfigEntry = response->add_config();
         currentConfigEntry->set_server(currentServer);
@@ -163,8 +215,25 @@
             currentShardEntry->set_upper(currentShard.upper);
         }
     }
-    lock.unlock();
-    return ::grpc::Status::OK;
 }
 
+void StaticShardmaster::configChanged() {
+    this->config_num++;
+    LOG_INFO << "config " << this->config_num << ": " << this->server_list.size() << " servers";
+    this->config_changed.notify_all();
+}
 
+/**
+ * Latencies of Join, Leave, Move and Query since we started.
+ *
+ * @param context - you can ignore this
+ * @param request - empty
+ * @param response the count, errors and latency percentiles of each method
+ * @return ::grpc::Status::OK
+ */
+::grpc::Status StaticShardmaster::Stats(::grpc::ServerContext* context,
+                                        const StaticShardmaster::Empty* request,
+                                        ::StatsResponse* response) {
+    stats.Fill(response);
+    return ::grpc::Status::OK;
+}
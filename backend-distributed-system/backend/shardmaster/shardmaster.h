@@ -2,11 +2,13 @@
 #define SHARDING_SHARDMASTER_H
 
 #include "../common/common.h"
+#include "../common/rpc_stats.h"
 #include <grpcpp/grpcpp.h>
 #include <unordered_map>
 #include <string>
 #include <vector>
 #include <mutex>
+#include <condition_variable>
 #include "../build/shardmaster.grpc.pb.h"
 
 class StaticShardmaster : public Shardmaster::Service {
@@ -22,11 +24,28 @@ class StaticShardmaster : public Shardmaster::Service {
                       const ::MoveRequest* request, Empty* response) override;
   ::grpc::Status Query(::grpc::ServerContext* context, const Empty* request,
                        ::QueryResponse* response) override;
+  ::grpc::Status Watch(::grpc::ServerContext* context,
+                       const ::WatchRequest* request,
+                       ::grpc::ServerWriter<::QueryResponse>* writer) override;
+  ::grpc::Status Stats(::grpc::ServerContext* context, const Empty* request,
+                       ::StatsResponse* response) override;
 
  private:
+  // both expect mutex to be held
+  void fillConfig(::QueryResponse* response);
+  void configChanged();
+
   std::mutex mutex; 
   std::unordered_map<std::string, std::vector<shard_t>> server_shards_map;
   std::vector<std::string> server_list; 
+  // number of the current config, see QueryResponse
+  uint64_t config_num = 0;
+  // signalled whenever config_num moves, wakes up the Watch streams
+  std::condition_variable config_changed;
+  // timings of the handlers, in the order of the STATS_ indexes. Watch streams
+  // for as long as the watcher stays, so it is left out.
+  enum : size_t { STATS_JOIN, STATS_LEAVE, STATS_MOVE, STATS_QUERY };
+  RpcStats stats{{"Join", "Leave", "Move", "Query"}};
 };
 
 #endif  // SHARDING_SHARDMASTER_H